@@ -26,6 +26,7 @@ typedef enum {
   IMPL_STATUS_SUCCESS = 0,
   IMPL_STATUS_INVALID_PARAMS,
   IMPL_STATUS_FAIL,
+  IMPL_STATUS_BUSY,
   IMPL_STATUS_MAX
 } IMPL_STATUS;
 
@@ -66,9 +67,99 @@ typedef enum {
     IMPL_INTERP_MTD_BILINEAR = 0,
     /** IMPL bicubic interpolate method */
     IMPL_INTERP_MTD_BICUBIC,
+    /** IMPL nearest neighbour method, for previews */
+    IMPL_INTERP_MTD_NEAREST,
+    /** IMPL area (box) method, averages the covered source pixels, for large downscales */
+    IMPL_INTERP_MTD_AREA,
     IMPL_INTERP_MTD_MAX
 } impl_interp_mtd;
 
+/**
+ * IMPL resize interpolation arithmetic
+ */
+typedef enum {
+    /** float weights and accumulation, default */
+    IMPL_INTERP_ARITH_FLOAT = 0,
+    /** Q14 integer weights with int32 accumulation, samples within 1 of the float result */
+    IMPL_INTERP_ARITH_FIXED,
+    IMPL_INTERP_ARITH_MAX
+} impl_interp_arith;
+
+/**
+ * IMPL 3D LUT interpolation method
+ */
+typedef enum {
+    /** tetrahedral interpolation of 4 lattice points, default */
+    IMPL_LUT3D_INTERP_TETRAHEDRAL = 0,
+    /** trilinear interpolation of the 8 surrounding lattice points */
+    IMPL_LUT3D_INTERP_TRILINEAR,
+    IMPL_LUT3D_INTERP_MAX
+} impl_lut3d_interp;
+
+/**
+ * IMPL 3D LUT channel mapping
+ */
+typedef enum {
+    /** pixels are converted to R'G'B' before lookup and back to Y'CbCr after, cube axes are R, G, B */
+    IMPL_LUT3D_MAPPING_RGB = 0,
+    /** cube is indexed by Y, Cb, Cr codes directly */
+    IMPL_LUT3D_MAPPING_YUV,
+    IMPL_LUT3D_MAPPING_MAX
+} impl_lut3d_mapping;
+
+/**
+ * IMPL colour primaries, used by CSC colorimetry conversion
+ */
+typedef enum {
+    /** unspecified, same as source for destination, BT.709 for source */
+    IMPL_COLOR_PRIMARIES_UNSPECIFIED = 0,
+    /** ITU-R BT.709 primaries */
+    IMPL_COLOR_PRIMARIES_BT709,
+    /** ITU-R BT.2020 primaries */
+    IMPL_COLOR_PRIMARIES_BT2020,
+    IMPL_COLOR_PRIMARIES_MAX
+} impl_color_primaries;
+
+/**
+ * IMPL transfer characteristics, used by CSC colorimetry conversion
+ */
+typedef enum {
+    /** unspecified, same as source for destination, BT.709 SDR for source */
+    IMPL_COLOR_TRC_UNSPECIFIED = 0,
+    /** ITU-R BT.709 / BT.2020 SDR gamma */
+    IMPL_COLOR_TRC_BT709,
+    /** SMPTE ST 2084 perceptual quantizer */
+    IMPL_COLOR_TRC_PQ,
+    /** ARIB STD-B67 / ITU-R BT.2100 hybrid log-gamma */
+    IMPL_COLOR_TRC_HLG,
+    IMPL_COLOR_TRC_MAX
+} impl_color_trc;
+
+/**
+ * IMPL quantization range, used by CSC colorimetry conversion
+ */
+typedef enum {
+    /** unspecified, same as source for destination, limited for source */
+    IMPL_COLOR_RANGE_UNSPECIFIED = 0,
+    /** limited(narrow) range, 64~940 for 10 bit luma */
+    IMPL_COLOR_RANGE_LIMITED,
+    /** full range, 0~1023 for 10 bit luma */
+    IMPL_COLOR_RANGE_FULL,
+    IMPL_COLOR_RANGE_MAX
+} impl_color_range;
+
+/**
+ * IMPL colorimetry description of a video signal
+ */
+struct impl_colorimetry {
+    /** colour primaries */
+    impl_color_primaries primaries;
+    /** transfer characteristics */
+    impl_color_trc trc;
+    /** quantization range */
+    impl_color_range range;
+};
+
 /**
  * Retrieve IMPL version value
  */
@@ -86,6 +177,50 @@ IMPL_API float impl_version();
  */
 IMPL_API void* impl_common_init(bool is_target_cpu, bool enable_profiling);
 
+/**
+ * initialize IMPL to generate a new in-order queue for linear pipelines.
+ * Commands run in submission order, so a filter needs no dep_evt on the one before it.
+ * Without profiling the queue discards events: evt of a run or copy stays a completed
+ * event, synchronous runs wait on the queue, and impl_common_queue_sync waits for the
+ * pipeline.
+ *
+ * @param is_target_cpu
+ *   Indicate if the target is CPU or GPU.
+ * @param enable_profiling
+ *   Indicate if enabling profiling for the queue, events are then kept.
+ * @return
+ *   - void queue pointer.
+ */
+IMPL_API void* impl_common_init_in_order(bool is_target_cpu, bool enable_profiling);
+
+/**
+ * IMPL CPU execution parameters
+ */
+struct impl_cpu_params {
+    /** threads running the kernels, the compute units of the sub-device the queue runs on, 0 is the whole device */
+    int num_threads;
+    /** if the queue gets a sub-device of its own, and so its own cores and thread pool,
+     *  instead of sharing one with the other queues that are not isolated */
+    bool isolate;
+};
+
+/**
+ * initialize IMPL to generate a new CPU queue with execution options.
+ * num_threads partitions the CPU device into equal sub-devices of that many compute units, which never overlap.
+ * All CPU queues with num_threads run in one context and must use the same num_threads until the last of them
+ * is freed by impl_common_uninit. Thread pinning is not a queue option, the CPU runtime reads it from
+ * DPCPP_CPU_CU_AFFINITY (close or spread) at startup, and a core list is set around the process with taskset
+ * or cgroups.
+ *
+ * @param pcpu
+ *   The impl_cpu_params pointer.
+ * @param enable_profiling
+ *   Indicate if enabling profiling for the queue.
+ * @return
+ *   - void queue pointer, NULL on failure or when every sub-device is taken by an isolated queue.
+ */
+IMPL_API void* impl_common_init_cpu(struct impl_cpu_params *pcpu, bool enable_profiling);
+
 /**
  * allocate IMPL Unified Shared Memory(USM).
  *
@@ -143,6 +278,55 @@ IMPL_API unsigned char* impl_image_mem_alloc(void *pq, impl_video_format format,
  */
 IMPL_API void impl_common_mem_copy(void *pq, void *evt, void *dst, void *src, int size, void *dep_evt, bool is_sync);
 
+/**
+ * IMPL joins several events into one on the device, for a run that depends on more than one producer.
+ * evt completes after every event in dep_evts and can be passed as the dep_evt of any run or copy,
+ * so the fan-in needs no host wait.
+ * Queues from impl_common_init_in_order without profiling discard events and have no event to join into,
+ * so this call returns IMPL_STATUS_INVALID_PARAMS for them and leaves evt untouched.
+ *
+ * @param pq
+ *   The queue pointer of the consumer.
+ * @param evt
+ *   The joined event pointer, from impl_common_new_event.
+ * @param dep_evts
+ *   The events to join, NULL entries are skipped.
+ * @param num_evts
+ *   The number of events in dep_evts.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_common_event_join(void *pq, void *evt, void *dep_evts[], int num_evts);
+
+/**
+ * IMPL completion callback, called with the user_data of impl_common_event_on_complete.
+ */
+typedef void (*impl_event_callback)(void *user_data);
+
+/**
+ * IMPL calls a callback when an event completes, without blocking the calling thread.
+ * The callback runs on a runtime thread, so it must be short and must not wait on the queue. It is scheduled on an
+ * internal out-of-order queue of the same context, so later runs on an in-order pq do not wait for it.
+ * Queues from impl_common_init_in_order without profiling discard events, the evt of their runs
+ * is always complete, so this call returns IMPL_STATUS_INVALID_PARAMS for them.
+ *
+ * @param pq
+ *   The queue pointer the event was submitted to.
+ * @param evt
+ *   The event pointer, it may be reused once this call returns.
+ * @param callback
+ *   The callback.
+ * @param user_data
+ *   Passed to the callback.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_common_event_on_complete(void *pq, void *evt, impl_event_callback callback, void *user_data);
+
 /**
  * IMPL synchronous waiting queue.
  *
@@ -203,6 +387,191 @@ IMPL_API void* impl_common_new_event();
  */
 IMPL_API void impl_common_free_event(void *evt);
 
+#define IMPL_ENGINE_MAX_QUEUES 16
+
+/**
+ * IMPL engine stream to queue assignment
+ */
+typedef enum {
+    /** streams take the compute queues in turn */
+    IMPL_ENGINE_ROUND_ROBIN = 0,
+    /** a stream takes the compute queue serving the fewest streams */
+    IMPL_ENGINE_LEAST_LOADED,
+    IMPL_ENGINE_POLICY_MAX
+} impl_engine_policy;
+
+/**
+ * IMPL engine action when a queue has max_in_flight frames in flight
+ */
+typedef enum {
+    /** impl_engine_begin_frame waits for the oldest frame of the queue */
+    IMPL_ENGINE_BLOCK = 0,
+    /** impl_engine_begin_frame returns IMPL_STATUS_BUSY at once */
+    IMPL_ENGINE_FAIL_FAST,
+    IMPL_ENGINE_BACKPRESSURE_MAX
+} impl_engine_backpressure;
+
+/**
+ * IMPL engine parameters
+ */
+struct impl_engine_params {
+    /** if the target is CPU or GPU */
+    bool is_target_cpu;
+    /** if enabling profiling for all queues */
+    bool enable_profiling;
+    /** if the queues are in-order */
+    bool in_order;
+    /** number of compute queues, 1 .. IMPL_ENGINE_MAX_QUEUES */
+    int num_queues;
+    /** stream to compute queue assignment */
+    impl_engine_policy policy;
+    /** if creating a separate queue for impl_common_mem_copy */
+    bool transfer_queue;
+    /** frames in flight per compute queue before backpressure applies, 0 is unbounded. Only frames bracketed by
+     *  impl_engine_begin_frame and impl_engine_end_frame are counted */
+    int max_in_flight;
+    /** action when a compute queue is full */
+    impl_engine_backpressure backpressure;
+};
+
+/**
+ * IMPL engine queue depth counters
+ */
+struct impl_engine_stats {
+    /** frames begun and not yet completed */
+    int in_flight;
+    /** frames admitted by impl_engine_begin_frame */
+    size_t admitted;
+    /** impl_engine_begin_frame calls that had to wait */
+    size_t blocked;
+    /** impl_engine_begin_frame calls refused with IMPL_STATUS_BUSY */
+    size_t rejected;
+};
+
+/**
+ * IMPL engine initialize, creates one context on the selected device and all queues on it,
+ * so memory allocated from any engine queue can be used on every other one.
+ *
+ * @param pen
+ *   The impl_engine_params pointer.
+ * @param pen_context
+ *   The engine context will be created.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_engine_init(struct impl_engine_params *pen, void *&pen_context);
+
+/**
+ * IMPL engine assigns a compute queue to a new stream, thread safe.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @param queue_index
+ *   Returns the index of the queue, passed to impl_engine_release_queue when the stream ends.
+ * @return
+ *   - void queue pointer for the filter pq and the impl_common memory functions,
+ *     owned by the engine and not freed by impl_common_uninit.
+ */
+IMPL_API void* impl_engine_get_queue(void *pen_context, int *queue_index);
+
+/**
+ * IMPL engine releases the compute queue of an ended stream, thread safe.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @param queue_index
+ *   The index returned by impl_engine_get_queue.
+ */
+IMPL_API void impl_engine_release_queue(void *pen_context, int queue_index);
+
+/**
+ * IMPL engine admits a frame of a stream on its compute queue before the frame's runs are submitted, thread safe.
+ * Every admitted frame must be closed with impl_engine_end_frame. Backpressure only counts these bracketed frames,
+ * runs submitted on the queue outside a bracket are not limited and not counted, nor are queues from impl_common_init.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @param queue_index
+ *   The index returned by impl_engine_get_queue.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if the frame can be submitted.
+ *   - IMPL_STATUS_BUSY if the queue is full and backpressure is IMPL_ENGINE_FAIL_FAST.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ */
+IMPL_API IMPL_STATUS impl_engine_begin_frame(void *pen_context, int queue_index);
+
+/**
+ * IMPL engine closes an admitted frame, thread safe.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @param queue_index
+ *   The index passed to impl_engine_begin_frame.
+ * @param evt
+ *   The event of the last run of the frame, the frame is in flight until it completes.
+ *   Engine queues never discard events, so the evt of a run or _run_evt on them is valid.
+ *   NULL if nothing was submitted.
+ */
+IMPL_API void impl_engine_end_frame(void *pen_context, int queue_index, void *evt);
+
+/**
+ * IMPL engine queue depth counters of a compute queue, thread safe.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @param queue_index
+ *   The compute queue index.
+ * @param pstats
+ *   Returns the counters.
+ */
+IMPL_API void impl_engine_get_stats(void *pen_context, int queue_index, struct impl_engine_stats *pstats);
+
+/**
+ * IMPL engine transfer queue, copies on it overlap with kernels on the compute queues.
+ *
+ * @param pen_context
+ *   The engine context.
+ * @return
+ *   - void queue pointer, the first compute queue if no transfer queue was created.
+ */
+IMPL_API void* impl_engine_transfer_queue(void *pen_context);
+
+/**
+ * IMPL engine synchronous waiting of all its queues.
+ *
+ * @param pen_context
+ *   The engine context.
+ */
+IMPL_API void impl_engine_sync(void *pen_context);
+
+/**
+ * IMPL engine free, releases all queues.
+ *
+ * @param pen_context
+ *   The engine context, will be released
+ */
+IMPL_API void impl_engine_uninit(void *pen_context);
+
+/**
+ * take an event from the IMPL event pool, thread safe.
+ * The _run_evt filter APIs return their completion events from this pool.
+ *
+ * @return
+ *   - event pointer, a completed event.
+ */
+IMPL_API void* impl_common_acquire_event();
+
+/**
+ * return an event to the IMPL event pool, thread safe.
+ *
+ * @param evt
+ *   The event pointer from impl_common_acquire_event or a _run_evt API.
+ *   Its task must have completed or be depended on by tasks already submitted.
+ */
+IMPL_API void impl_common_release_event(void *evt);
+
 /**
  * IMPL color space conversion(CSC) structure
  */
@@ -221,11 +590,22 @@ struct impl_csc_params {
     int width;
     /** IMPL CSC source height */
     int height;
+    /** IMPL CSC source colorimetry, all zero means BT.709 SDR limited range */
+    struct impl_colorimetry src_color;
+    /** IMPL CSC destination colorimetry, unspecified members follow src_color */
+    struct impl_colorimetry dst_color;
+    /** optional impl_lut3d context applied after the conversion, must outlive the CSC context */
+    void *lut3d_context;
 };
 
 /**
  * IMPL color space conversion structure initialize
  *
+ * Setups with colorimetry conversion or a 3D LUT use the generic kernel, which supports
+ * every in/out pair. Other pairs without a dedicated kernel are accepted for
+ * impl_csc_multi_run and impl_csc_packet_run, which ignore out_format, and rejected by
+ * impl_csc_run.
+ *
  * @param pcsc
  *   IMPL impl_csc_params pointer
  *   All CSC parameters must be set before impl_csc_init
@@ -240,6 +620,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
 
 /**
  * IMPL color space conversion process runs.
+ * Returns IMPL_STATUS_INVALID_PARAMS for in/out pairs without a kernel.
  *
  * @param pcsc
  *   The impl_csc_params pointer.
@@ -259,6 +640,205 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
  */
 IMPL_API IMPL_STATUS impl_csc_run(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in, unsigned char *buf_dst, void *dep_evt);
 
+/**
+ * IMPL csc reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param pcsc
+ *   The impl_csc_params pointer.
+ * @param pcsc_context
+ *   void csc context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_dst
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that csc needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_csc_run_evt(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                                      unsigned char *buf_dst, void *dep_evt, void *&evt);
+
+/** IMPL CSC max outputs of impl_csc_multi_run */
+#define IMPL_CSC_MAX_OUTPUTS 8
+
+/**
+ * IMPL CSC output of impl_csc_multi_run
+ */
+struct impl_csc_output {
+    /** IMPL CSC output video format */
+    impl_video_format format;
+    /** Destination video buffer pointer */
+    unsigned char *buf;
+};
+
+/**
+ * IMPL color space conversion to several output formats.
+ *
+ * The input is read and unpacked once and written to every output in one kernel.
+ * pcsc->out_format is ignored, any IMPL video format can be an output and the
+ * colorimetry conversion and 3D LUT set up by impl_csc_init apply to all outputs.
+ *
+ * @param pcsc
+ *   The impl_csc_params pointer.
+ * @param pcsc_context
+ *   void CSC context pointer
+ * @param buf_in
+ *   Source video buffer pointer.
+ * @param outputs
+ *   Output format and destination buffer pairs.
+ * @param num_outputs
+ *   Number of outputs, 1 ~ IMPL_CSC_MAX_OUTPUTS.
+ * @param dep_evt
+ *   dep_evt is the event that CSC needs to depend on.
+ *   After dep_evt ends, CSC runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_csc_multi_run(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                                        struct impl_csc_output *outputs, int num_outputs, void *dep_evt);
+
+/**
+ * IMPL ST 2110-20 / RFC 4175 packet of the CSC packetized output
+ */
+struct impl_st2110_packet {
+    /** packet buffer in host or shared USM, pgroups are written from buf + header_reserve */
+    unsigned char *buf;
+    /** line number of the first pixel in the packet */
+    int line;
+    /** pixel offset in the line of the first pixel, a multiple of 2 */
+    int offset;
+    /** pgroup payload bytes of this packet, a multiple of 5 up to payload_size, 0 means payload_size */
+    int length;
+};
+
+/**
+ * IMPL ST 2110-20 / RFC 4175 packetization descriptor
+ *
+ * Every packet carries whole 5 byte yuv422ycbcr10be pgroups, a packet reaching the
+ * end of its line continues at offset 0 of the next line, as a packet with a
+ * continuation sample row data header does.
+ */
+struct impl_st2110_packetizer {
+    /** pgroup payload bytes per packet, a multiple of 5 */
+    int payload_size;
+    /** bytes reserved for RTP and sample row data headers in front of the payload */
+    int header_reserve;
+    /** number of packets */
+    int num_packets;
+    /** packet array in host or shared USM, checked on the host and valid until the CSC event completes */
+    struct impl_st2110_packet *packets;
+};
+
+/**
+ * IMPL color space conversion to yuv422ycbcr10be packet payloads.
+ *
+ * pgroups are written straight into the packet buffers of the descriptor instead of
+ * a contiguous frame, pcsc->out_format is not used by this call. The colorimetry conversion and
+ * 3D LUT set up by impl_csc_init apply.
+ *
+ * @param pcsc
+ *   The impl_csc_params pointer.
+ * @param pcsc_context
+ *   void CSC context pointer
+ * @param buf_in
+ *   Source video buffer pointer.
+ * @param ppkt
+ *   The packetization descriptor.
+ * @param dep_evt
+ *   dep_evt is the event that CSC needs to depend on.
+ *   After dep_evt ends, CSC runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_csc_packet_run(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                                         struct impl_st2110_packetizer *ppkt, void *dep_evt);
+
+/**
+ * IMPL scatter-gather input fill policy for pixels no segment covers
+ */
+typedef enum {
+    /** missing pgroups are black */
+    IMPL_SG_FILL_BLACK = 0,
+    /** missing pgroups are taken from fill_frame, e.g. the previous frame */
+    IMPL_SG_FILL_FRAME,
+    IMPL_SG_FILL_MAX
+} impl_sg_fill;
+
+/**
+ * IMPL scatter-gather input segment, a run of yuv422ycbcr10be pgroups within one line
+ */
+struct impl_sg_segment {
+    /** first pgroup of the segment, e.g. a sample row data payload in a packet ring */
+    const unsigned char *buf;
+    /** line number */
+    int line;
+    /** pixel offset in the line of the first pixel, a multiple of 2 */
+    int offset;
+    /** segment bytes, a multiple of 5 */
+    int length;
+};
+
+/**
+ * IMPL scatter-gather yuv422ycbcr10be input
+ *
+ * Segments must be ordered by line, a line may have any number of segments in any
+ * order, and every segment must lie inside its line. The segment array is checked on
+ * the host, so it must be host or shared USM. Segment data and fill_frame must be
+ * accessible by the device (shared or device USM, or host USM). All of them stay
+ * valid until the filter event completes.
+ */
+struct impl_sg_input {
+    /** number of segments */
+    int num_segments;
+    /** segment array */
+    struct impl_sg_segment *segments;
+    /** fill policy for pixels no segment covers */
+    impl_sg_fill fill;
+    /** contiguous yuv422ycbcr10be frame used by IMPL_SG_FILL_FRAME */
+    const unsigned char *fill_frame;
+};
+
+/**
+ * IMPL color space conversion from a scatter-gather yuv422ycbcr10be input.
+ *
+ * The kernel gathers pgroups straight from the segments, no contiguous input frame is
+ * needed. pcsc->in_format must be IMPL_VIDEO_YUV422YCBCR10BE, any output format is
+ * supported and the colorimetry conversion and 3D LUT set up by impl_csc_init apply.
+ * Successive runs on one context are ordered by the line index they share, so calls on
+ * one context must not be made from several threads at once.
+ *
+ * @param pcsc
+ *   The impl_csc_params pointer.
+ * @param pcsc_context
+ *   void CSC context pointer
+ * @param pin
+ *   The scatter-gather input.
+ * @param buf_dst
+ *   Desternation video buffer pointer.
+ * @param dep_evt
+ *   dep_evt is the event that CSC needs to depend on.
+ *   After dep_evt ends, CSC runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_csc_sg_run(struct impl_csc_params *pcsc, void *pcsc_context, struct impl_sg_input *pin,
+                                     unsigned char *buf_dst, void *dep_evt);
+
 /**
  * IMPL color space conversion structure free.
  *
@@ -303,6 +883,26 @@ struct impl_resize_params {
     int pitch_pixel;
     /** Hight in pixel of output surface */
     int surface_height;
+    /** X coordinate of the source crop in source pixels, fractional for sub-pixel pan */
+    float crop_x;
+    /** Y coordinate of the source crop in source pixels */
+    float crop_y;
+    /** Width of the source crop in source pixels, 0 resizes the whole source */
+    float crop_w;
+    /** Height of the source crop in source pixels, 0 resizes the whole source */
+    float crop_h;
+    /** fit the source into dst_width x dst_height keeping its aspect ratio, centered between fill bars */
+    bool aspect_fit;
+    /** Y of the aspect_fit bars, in the sample depth of the format, e.g. 16 or 64 for black */
+    unsigned short fill_y;
+    /** Cb of the aspect_fit bars, e.g. 128 or 512 for black */
+    unsigned short fill_cb;
+    /** Cr of the aspect_fit bars, e.g. 128 or 512 for black */
+    unsigned short fill_cr;
+    /** interpolation arithmetic, default is IMPL_INTERP_ARITH_FLOAT. IMPL_INTERP_ARITH_FIXED is only
+     *  supported for bilinear and bicubic, impl_resize_init rejects it for nearest and area, and
+     *  impl_resize_sg_run always uses float */
+    impl_interp_arith interp_arith;
 };
 
 /**
@@ -344,6 +944,59 @@ IMPL_API IMPL_STATUS impl_resize_init(struct impl_resize_params *prs, void *&prs
  */
 IMPL_API IMPL_STATUS impl_resize_run(struct impl_resize_params *prs, void *prs_context, unsigned char *buf_in, unsigned char *buf_out, void *dep_evt);
 
+/**
+ * IMPL resize reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param prs
+ *   The impl_resize_params pointer.
+ * @param prs_context
+ *   void resize context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that resize needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_resize_run_evt(struct impl_resize_params *prs, void *prs_context, unsigned char *buf_in,
+                                         unsigned char *buf_out, void *dep_evt, void *&evt);
+
+/**
+ * IMPL resize from a scatter-gather yuv422ycbcr10be input
+ *
+ * prs->format must be IMPL_VIDEO_YUV422YCBCR10BE, interpolation taps are gathered
+ * straight from the segments. Successive runs on one context are ordered by the line
+ * index they share, so calls on one context must not be made from several threads at once.
+ *
+ * @param prs
+ *   The struct impl_resize_params pointer.
+ * @param prs_context
+ *   void resize context pointer
+ * @param pin
+ *   The scatter-gather input.
+ * @param buf_out
+ *   Desternation buffer pointer.
+ * @param dep_evt
+ *   dep_evt is the event that resize needs to depend on.
+ *   After dep_evt ends, resize runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_resize_sg_run(struct impl_resize_params *prs, void *prs_context, struct impl_sg_input *pin,
+                                        unsigned char *buf_out, void *dep_evt);
+
 /**
  * IMPL resize uninitialize.
  *
@@ -360,6 +1013,260 @@ IMPL_API IMPL_STATUS impl_resize_run(struct impl_resize_params *prs, void *prs_c
  */
 IMPL_API IMPL_STATUS impl_resize_uninit(struct impl_resize_params *prs, void *prs_context);
 
+/** IMPL pyramid max levels, the last one is 1/16 of the source */
+#define IMPL_PYRAMID_MAX_LEVELS 4
+
+/**
+ * IMPL pyramid level, level i is 1 / 2^(i + 1) of the source
+ */
+struct impl_pyramid_level {
+    /** X coordinate for first pixel in output surface */
+    int offset_x;
+    /** Y coordinate for first pixel in output surface */
+    int offset_y;
+    /** Stride in pixel of output surface, 0 is the level width */
+    int pitch_pixel;
+    /** Hight in pixel of output surface, 0 is the level height */
+    int surface_height;
+    /** level width, set by impl_pyramid_init */
+    int width;
+    /** level height, set by impl_pyramid_init */
+    int height;
+};
+
+/**
+ * IMPL pyramid parameters
+ */
+struct impl_pyramid_params {
+    /** void queue pointer */
+    void *pq;
+    /** void event pointer */
+    void *evt;
+    /** if asynchronous mode */
+    bool is_async;
+    /** IMPL video format */
+    impl_video_format format;
+    /** IMPL pyramid source width */
+    int src_width;
+    /** IMPL pyramid source height */
+    int src_height;
+    /** number of levels, 1 ~ IMPL_PYRAMID_MAX_LEVELS */
+    int num_levels;
+    /** output placement of every level */
+    struct impl_pyramid_level levels[IMPL_PYRAMID_MAX_LEVELS];
+};
+
+/**
+ * IMPL pyramid initialize.
+ *
+ * Checks the parameters and sets the size of every level, half the size of the level
+ * above rounded down to a multiple of 2, or of 6 in width for v210.
+ *
+ * @param ppy
+ *   The impl_pyramid_params pointer.
+ *   All pyramid parameters must be set before impl_pyramid_init
+ * @param ppy_context
+ *   The pyramid context will be created.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_pyramid_init(struct impl_pyramid_params *ppy, void *&ppy_context);
+
+/**
+ * IMPL pyramid starts running.
+ *
+ * All levels are produced by one kernel that reads the source once, every level is the
+ * 2x2 box average of the level above and is kept in local memory until the next one is
+ * built from it.
+ *
+ * @param ppy
+ *   The impl_pyramid_params pointer.
+ * @param ppy_context
+ *   void pyramid context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_levels
+ *   Destination buffer of every level, levels may share one buffer at different offsets.
+ * @param dep_evt
+ *   dep_evt is the event that pyramid needs to depend on.
+ *   After dep_evt ends, pyramid runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_pyramid_run(struct impl_pyramid_params *ppy, void *ppy_context, unsigned char *buf_in,
+                                      unsigned char *buf_levels[], void *dep_evt);
+
+/**
+ * IMPL pyramid reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param ppy
+ *   The impl_pyramid_params pointer.
+ * @param ppy_context
+ *   void pyramid context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_levels
+ *   The level buffers.
+ * @param dep_evt
+ *   dep_evt is the event that pyramid needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_pyramid_run_evt(struct impl_pyramid_params *ppy, void *ppy_context, unsigned char *buf_in,
+                                          unsigned char *buf_levels[], void *dep_evt, void *&evt);
+
+/**
+ * IMPL pyramid free.
+ *
+ * @param ppy
+ *   The impl_pyramid_params pointer.
+ * @param ppy_context
+ *   The pyramid context, will be released
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_pyramid_uninit(struct impl_pyramid_params *ppy, void *ppy_context);
+
+/**
+ * IMPL warp parameters
+ *
+ * matrix maps source pixel coordinates to destination coordinates relative to
+ * (offset_x, offset_y), x' = m[0] * x + m[1] * y + m[2] and y' = m[3] * x + m[4] * y + m[5],
+ * pixel (i, j) covers [i, i + 1) x [j, j + 1). E.g. {dst_width / src_width, 0, 0, 0,
+ * dst_height / src_height, 0} samples as resize does.
+ */
+struct impl_warp_params {
+    /** void queue pointer */
+    void *pq;
+    /** void event pointer */
+    void *evt;
+    /** if asynchronous mode */
+    bool is_async;
+    /** interpolation method, bilinear, bicubic or nearest */
+    impl_interp_mtd interp_mtd;
+    /** IMPL video format */
+    impl_video_format format;
+    /** IMPL warp source width */
+    int src_width;
+    /** IMPL warp source height */
+    int src_height;
+    /** IMPL warp destination width */
+    int dst_width;
+    /** IMPL warp destination height */
+    int dst_height;
+    /** X coordinate for first pixel in output surface */
+    int offset_x;
+    /** Y coordinate for first pixel in output surface */
+    int offset_y;
+    /** Stride in pixel of output surface */
+    int pitch_pixel;
+    /** Hight in pixel of output surface */
+    int surface_height;
+    /** 2x3 affine matrix from source to destination, read on every run */
+    float matrix[6];
+    /** Y of destination pixels outside the source, in the sample depth of the format */
+    unsigned short fill_y;
+    /** Cb of destination pixels outside the source */
+    unsigned short fill_cb;
+    /** Cr of destination pixels outside the source */
+    unsigned short fill_cr;
+};
+
+/**
+ * IMPL warp initialize.
+ *
+ * @param pwp
+ *   The impl_warp_params pointer.
+ *   All warp parameters must be set before impl_warp_init
+ * @param pwp_context
+ *   The warp context will be created.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_warp_init(struct impl_warp_params *pwp, void *&pwp_context);
+
+/**
+ * IMPL warp starts running.
+ *
+ * Every destination pixel is mapped back through the inverse of pwp->matrix and
+ * interpolated from the source, pixels mapped outside the source get the fill values.
+ *
+ * @param pwp
+ *   The impl_warp_params pointer.
+ * @param pwp_context
+ *   void warp context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that warp needs to depend on.
+ *   After dep_evt ends, warp runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters, e.g. a singular matrix
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_warp_run(struct impl_warp_params *pwp, void *pwp_context, unsigned char *buf_in,
+                                   unsigned char *buf_out, void *dep_evt);
+
+/**
+ * IMPL warp reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param pwp
+ *   The impl_warp_params pointer.
+ * @param pwp_context
+ *   void warp context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that warp needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_warp_run_evt(struct impl_warp_params *pwp, void *pwp_context, unsigned char *buf_in,
+                                       unsigned char *buf_out, void *dep_evt, void *&evt);
+
+/**
+ * IMPL warp free.
+ *
+ * @param pwp
+ *   The impl_warp_params pointer.
+ * @param pwp_context
+ *   The warp context, will be released
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_warp_uninit(struct impl_warp_params *pwp, void *pwp_context);
+
 /** IMPL mixer max supported fields number */
 #define IMPL_MIXER_MAX_FIELDS 20
 
@@ -468,6 +1375,18 @@ IMPL_API IMPL_STATUS impl_mixer_run(struct impl_mixer_params *pmixer, void *pmx_
  */
 IMPL_API IMPL_STATUS impl_mixer_uninit(struct impl_mixer_params *pmixer, void *pmx_context);
 
+/**
+ * IMPL rotation mirror, applied to the rotated image
+ */
+typedef enum {
+    IMPL_FLIP_NONE = 0,
+    /** mirror left and right */
+    IMPL_FLIP_HORIZONTAL,
+    /** mirror top and bottom */
+    IMPL_FLIP_VERTICAL,
+    IMPL_FLIP_MAX
+} impl_rotation_flip;
+
 /**
  * IMPL rotation parameters
  */
@@ -492,6 +1411,11 @@ struct impl_rotation_params {
     int angle;
     /** IMPL rotation function index */
     int rotation_func_index;
+    /** IMPL rotation mirror, angle 90 with IMPL_FLIP_HORIZONTAL is a transpose */
+    impl_rotation_flip flip;
+    /** rotate buf_in in place and ignore buf_out, only for angle 0 and 180 without flip.
+     *  Angle 0 moves no pixels, it only submits a barrier on dep_evt for evt */
+    bool in_place;
 };
 
 /**
@@ -530,6 +1454,33 @@ IMPL_API IMPL_STATUS impl_rotation_init(struct impl_rotation_params *prt, void *
  */
 IMPL_API IMPL_STATUS impl_rotation_run(struct impl_rotation_params *prt, void *prt_context, unsigned char *buf_in, unsigned char *buf_out, void *dep_evt);
 
+/**
+ * IMPL rotation reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param prt
+ *   The impl_rotation_params pointer.
+ * @param prt_context
+ *   void rotation context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that rotation needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_rotation_run_evt(struct impl_rotation_params *prt, void *prt_context, unsigned char *buf_in,
+                                           unsigned char *buf_out, void *dep_evt, void *&evt);
+
 /**
  * IMPL rotation free.
  *
@@ -540,6 +1491,116 @@ IMPL_API IMPL_STATUS impl_rotation_run(struct impl_rotation_params *prt, void *p
  */
 IMPL_API void impl_rotation_uninit(struct impl_rotation_params *prt, void *prt_context);
 
+/**
+ * IMPL 3D LUT parameters
+ */
+struct impl_lut3d_params {
+    /** void queue pointer */
+    void *pq;
+    /** void event pointer */
+    void *evt;
+    /** if asynchronous mode */
+    bool is_async;
+    /** IMPL video format */
+    impl_video_format format;
+    /** IMPL 3D LUT frame width */
+    int width;
+    /** IMPL 3D LUT frame height */
+    int height;
+    /** interpolation method */
+    impl_lut3d_interp interp;
+    /** channel mapping */
+    impl_lut3d_mapping mapping;
+    /** primaries and range used to convert to R'G'B' for IMPL_LUT3D_MAPPING_RGB, trc is ignored */
+    struct impl_colorimetry color;
+    /** .3dlut file in Intel 17/33/65 point layout, the cube size is taken from the file size */
+    const char *lut_file;
+    /** host LUT data in the same layout, used when lut_file is NULL */
+    const unsigned short *lut_data;
+    /** lattice points per axis of lut_data, 17, 33 or 65 */
+    int lut_size;
+};
+
+/**
+ * IMPL 3D LUT initialize.
+ *
+ * Loads the cube into device memory once, it is kept for the life of the context.
+ *
+ * @param plut
+ *   The impl_lut3d_params pointer.
+ *   All 3D LUT parameters must be set before impl_lut3d_init
+ * @param plut_context
+ *   The 3D LUT context will be created.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_lut3d_init(struct impl_lut3d_params *plut, void *&plut_context);
+
+/**
+ * IMPL 3D LUT starts running.
+ *
+ * @param plut
+ *   The impl_lut3d_params pointer.
+ * @param plut_context
+ *   void 3D LUT context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer, may be buf_in for 4:2:2 formats.
+ * @param dep_evt
+ *   dep_evt is the event that 3D LUT needs to depend on.
+ *   After dep_evt ends, 3D LUT runs.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_lut3d_run(struct impl_lut3d_params *plut, void *plut_context, unsigned char *buf_in,
+                                    unsigned char *buf_out, void *dep_evt);
+
+/**
+ * IMPL lut3d reentrant run, the params evt is not used and every call gets its own completion event,
+ * so one context can have several frames in flight, from several threads.
+ * Queues from impl_common_init_in_order without profiling discard events, so this call
+ * returns IMPL_STATUS_INVALID_PARAMS on them instead of an event that is already complete.
+ *
+ * @param plut
+ *   The impl_lut3d_params pointer.
+ * @param plut_context
+ *   void lut3d context pointer.
+ * @param buf_in
+ *   The source buffer.
+ * @param buf_out
+ *   The destination buffer.
+ * @param dep_evt
+ *   dep_evt is the event that lut3d needs to depend on.
+ * @param evt
+ *   Returns the completion event of this call, NULL on failure.
+ *   Release it with impl_common_release_event.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_lut3d_run_evt(struct impl_lut3d_params *plut, void *plut_context, unsigned char *buf_in,
+                                        unsigned char *buf_out, void *dep_evt, void *&evt);
+
+/**
+ * IMPL 3D LUT free.
+ *
+ * @param plut
+ *   The impl_lut3d_params pointer.
+ * @param plut_context
+ *   The 3D LUT context, will be released
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_API IMPL_STATUS impl_lut3d_uninit(struct impl_lut3d_params *plut, void *plut_context);
+
 #ifdef __cplusplus
 }
 #endif
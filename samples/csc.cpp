@@ -9,6 +9,7 @@
 #include <unistd.h>
 
 #include <chrono>
+#include <utility>
 
 #include "defines.hpp"
 #include "getargs.hpp"
@@ -17,8 +18,11 @@
 
 inline void getArgs_csc(int argc, char **argv, char *pfilename, char *poutfilename, int &frames, int &width,
                         int &height, impl_video_format &in_format, impl_video_format &out_format,
-                        bool &enable_profiling, bool &is_target_cpu, bool &pre_read, bool &perfopt) {
-    std::string infile, outfile, informat_name, outformat_name, device_name;
+                        bool &enable_profiling, bool &is_target_cpu, bool &pre_read, bool &perfopt,
+                        struct impl_colorimetry &in_color, struct impl_colorimetry &out_color, std::string &lut_file,
+                        impl_lut3d_interp &lut_interp) {
+    std::string infile, outfile, informat_name, outformat_name, device_name, incolor_name, outcolor_name,
+        interp_name;
     ParseContext P;
 
     P.GetCommand(argc, argv);
@@ -33,11 +37,22 @@ inline void getArgs_csc(int argc, char **argv, char *pfilename, char *poutfilena
     P.get("-d", "device                    set gpu(default)/cpu", &device_name, (std::string) "gpu", false);
     P.get("-pre_read", "                   pre_read one frame in gpu buffer", &pre_read, (bool)false, false);
     P.get("-perfopt", "                    process frame in best performance", &perfopt, (bool)false, false);
+    P.get("-in_color", "primaries,trc,range set input colorimetry, e.g. bt2020,pq,limited", &incolor_name,
+          (std::string) "", false);
+    P.get("-out_color", "primaries,trc,range set output colorimetry, e.g. bt709,sdr", &outcolor_name,
+          (std::string) "", false);
+    P.get("-3dlut", "3dlut_filename         apply a 17/33/65 point Intel .3dlut file after the conversion", &lut_file,
+          (std::string) "", false);
+    P.get("-3dlut_interp", "method         set 3D LUT interpolation tetrahedral(default)/trilinear", &interp_name,
+          (std::string) "tetrahedral", false);
     P.check("usage:\tcsc [options]\noptions:");
 
     in_format     = GetIMPLformat(informat_name);
     out_format    = GetIMPLformat(outformat_name);
     is_target_cpu = getdevice(device_name);
+    in_color      = GetIMPLcolorimetry(incolor_name);
+    out_color     = GetIMPLcolorimetry(outcolor_name);
+    lut_interp    = interp_name == "trilinear" ? IMPL_LUT3D_INTERP_TRILINEAR : IMPL_LUT3D_INTERP_TETRAHEDRAL;
     memcpy(pfilename, infile.c_str(), infile.length() + 1);
     memcpy(poutfilename, outfile.c_str(), outfile.length() + 1);
     if (perfopt) {
@@ -68,6 +83,9 @@ int main(int argc, char **argv) {
     unsigned char *buf_dst = nullptr;
     unsigned char *buf_cpu = nullptr;
     impl_video_format csc_in_format, csc_out_format;
+    struct impl_colorimetry csc_in_color, csc_out_color;
+    std::string lut_file;
+    impl_lut3d_interp lut_interp;
 
     // no output file by default
     bool output_file = false;
@@ -88,7 +106,7 @@ int main(int argc, char **argv) {
 
     // get args from cmdline
     getArgs_csc(argc, argv, pfilename, outputfilename, frames, width, height, csc_in_format, csc_out_format,
-                enable_profiling, is_target_cpu, pre_read, perfopt);
+                enable_profiling, is_target_cpu, pre_read, perfopt, csc_in_color, csc_out_color, lut_file, lut_interp);
     // init queue depend on device type
     void *pq = impl_common_init(is_target_cpu, enable_profiling);
     // if outfilename is empty, no output file
@@ -120,10 +138,62 @@ int main(int argc, char **argv) {
     csc_params.out_format = csc_out_format;
     csc_params.width      = width;
     csc_params.height     = height;
+    csc_params.src_color  = csc_in_color;
+    csc_params.dst_color  = csc_out_color;
+    // the same conversion with the 3D LUT fused into the CSC kernel
+    struct impl_csc_params fused_params = csc_params;
+    void *pfused_context                = NULL;
 
     ret = impl_csc_init(&csc_params, pcsc_context);
     CHECK_IMPL(ret, "impl_csc_init");
 
+    struct impl_lut3d_params lut_params;
+    void *plut_context = NULL;
+    if (!lut_file.empty()) {
+        memset(&lut_params, 0, sizeof(lut_params));
+        lut_params.pq       = pq;
+        lut_params.is_async = false;
+        lut_params.format   = csc_out_format;
+        lut_params.width    = width;
+        lut_params.height   = height;
+        lut_params.interp   = lut_interp;
+        lut_params.mapping  = IMPL_LUT3D_MAPPING_RGB;
+        lut_params.color    = csc_out_color;
+        lut_params.lut_file = lut_file.c_str();
+        ret                 = impl_lut3d_init(&lut_params, plut_context);
+        CHECK_IMPL(ret, "impl_lut3d_init");
+        fused_params.lut3d_context = plut_context;
+        ret                        = impl_csc_init(&fused_params, pfused_context);
+        CHECK_IMPL(ret, "impl_csc_init with 3D LUT");
+
+        // the standalone 3D LUT after the CSC and the fused CSC of the first frame should agree, the fused kernel
+        // applies the LUT before chroma subsampling and output rounding, so subsampled outputs may differ slightly
+        ret = fread_repeat(data, 1, in_size, input, 0);
+        CHECK_IMPL(ret, "read one frame from file");
+        impl_common_mem_copy(pq, NULL, buf_in, data, in_size, NULL, 1);
+        unsigned char *buf_lut = impl_image_mem_alloc(pq, csc_out_format, width, height, IMPL_MEM_TYPE_DEVICE, NULL);
+        unsigned char *buf_ref = impl_image_mem_alloc(pq, csc_out_format, width, height, IMPL_MEM_TYPE_HOST, NULL);
+        ret                    = impl_csc_run(&csc_params, pcsc_context, buf_in, buf_dst, NULL);
+        CHECK_IMPL(ret, "impl_csc_run");
+        ret = impl_lut3d_run(&lut_params, plut_context, buf_dst, buf_lut, NULL);
+        CHECK_IMPL(ret, "impl_lut3d_run");
+        ret = impl_csc_run(&fused_params, pfused_context, buf_in, buf_dst, NULL);
+        CHECK_IMPL(ret, "impl_csc_run with 3D LUT");
+        impl_common_mem_copy(pq, NULL, buf_ref, buf_lut, out_size, NULL, 1);
+        impl_common_mem_copy(pq, NULL, buf_cpu, buf_dst, out_size, NULL, 1);
+        size_t mismatch = 0;
+        for (size_t i = 0; i < out_size; i++)
+            mismatch += buf_ref[i] != buf_cpu[i];
+        info("3D LUT %s %s: standalone and fused results differ in %zu of %zu bytes\n", lut_file.c_str(),
+             lut_interp == IMPL_LUT3D_INTERP_TRILINEAR ? "trilinear" : "tetrahedral", mismatch, out_size);
+        impl_common_mem_free(pq, (void *)buf_lut);
+        impl_common_mem_free(pq, (void *)buf_ref);
+
+        // the remaining frames run the fused conversion
+        std::swap(csc_params, fused_params);
+        std::swap(pcsc_context, pfused_context);
+    }
+
     {
         // do not count in time for the first frame for Just-in-Time compilation, start frame time is always very long,
         // ignore it for AOT
@@ -193,6 +263,13 @@ int main(int argc, char **argv) {
     impl_common_mem_free(pq, (void *)buf_cpu);
     ret = impl_csc_uninit(&csc_params, pcsc_context);
     CHECK_IMPL(ret, "impl_csc_uninit");
+    if (plut_context != NULL) {
+        // both CSC contexts use the 3D LUT context, which is freed last
+        ret = impl_csc_uninit(&fused_params, pfused_context);
+        CHECK_IMPL(ret, "impl_csc_uninit");
+        ret = impl_lut3d_uninit(&lut_params, plut_context);
+        CHECK_IMPL(ret, "impl_lut3d_uninit");
+    }
     fclose(input);
     if (output_file == true) {
         info("\nClosing output file...\n");
@@ -65,6 +65,48 @@ inline impl_video_format GetIMPLformat(std::string tempformat) {
     return format;
 }
 
+/* name of an IMPL video format as accepted by GetIMPLformat, in impl_video_format order */
+inline const char *GetIMPLformatName(impl_video_format format) {
+    static const char *names[IMPL_VIDEO_MAX] = {"i420", "v210", "y210", "nv12", "p010", "yuv420p10le",
+                                                "yuv422p10le", "yuv422ycbcr10be", "yuv422ycbcr10le"};
+    if (format < 0 || format >= IMPL_VIDEO_MAX)
+        return "unknown";
+    return names[format];
+}
+
+/* parse colorimetry like "bt2020,pq,limited", any member can be omitted */
+inline struct impl_colorimetry GetIMPLcolorimetry(std::string name) {
+    struct impl_colorimetry color = {IMPL_COLOR_PRIMARIES_UNSPECIFIED, IMPL_COLOR_TRC_UNSPECIFIED,
+                                     IMPL_COLOR_RANGE_UNSPECIFIED};
+    size_t start                  = 0;
+    while (start < name.length()) {
+        size_t end = name.find(',', start);
+        if (end == std::string::npos)
+            end = name.length();
+        std::string token = name.substr(start, end - start);
+        if (token == "bt709") {
+            color.primaries = IMPL_COLOR_PRIMARIES_BT709;
+        } else if (token == "bt2020") {
+            color.primaries = IMPL_COLOR_PRIMARIES_BT2020;
+        } else if (token == "sdr") {
+            color.trc = IMPL_COLOR_TRC_BT709;
+        } else if (token == "pq") {
+            color.trc = IMPL_COLOR_TRC_PQ;
+        } else if (token == "hlg") {
+            color.trc = IMPL_COLOR_TRC_HLG;
+        } else if (token == "limited") {
+            color.range = IMPL_COLOR_RANGE_LIMITED;
+        } else if (token == "full") {
+            color.range = IMPL_COLOR_RANGE_FULL;
+        } else {
+            err("colorimetry %s is not supported\n", token.c_str());
+            exit(-1);
+        }
+        start = end + 1;
+    }
+    return color;
+}
+
 inline int fread_repeat(void *data, size_t num, int sizef, FILE *input, int framenum) {
     int readsize = fread(data, num, sizef, input);
     if (readsize != sizef) {
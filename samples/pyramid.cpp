@@ -0,0 +1,162 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "defines.hpp"
+#include "getargs.hpp"
+#include "impl_api.h"
+#include "log.h"
+
+inline void getArgs_pyramid(int argc, char **argv, char *pfilename, char *poutfilename, int &width, int &height,
+                            impl_video_format &in_format, int &num_levels, bool &enable_profiling,
+                            bool &is_target_cpu) {
+    std::string infile, outfile, informat_name, device_name;
+    ParseContext P;
+
+    P.GetCommand(argc, argv);
+    P.get("-size", "widthXheight           set input size to [width x height]", width, height, "1920X1080", true);
+    P.get("-in_format", "input_format      set input picture format", &informat_name, (std::string) "", true);
+    P.get("-i", "input_filename            set input picture file", &infile, (std::string) "", true);
+    P.get("-o", "output_filename           set output filename of the in_format levels", &outfile,
+          (std::string) "", false);
+    P.get("-levels", "n                    number of pyramid levels", &num_levels, (int)IMPL_PYRAMID_MAX_LEVELS,
+          false);
+    P.get("-profile", "                    enable profiling, disabled by default", &enable_profiling, (bool)false,
+          false);
+    P.get("-d", "device                    set gpu(default)/cpu", &device_name, (std::string) "gpu", false);
+    P.check("usage:\tpyramid [options]\noptions:");
+
+    in_format     = GetIMPLformat(informat_name);
+    is_target_cpu = getdevice(device_name);
+    memcpy(pfilename, infile.c_str(), infile.length() + 1);
+    memcpy(poutfilename, outfile.c_str(), outfile.length() + 1);
+    info("input bitstream %s src_size %dx%d in_format %s levels %d\n ", pfilename, width, height,
+         informat_name.c_str(), num_levels);
+}
+
+int main(int argc, char **argv) {
+    char pfilename[512]      = "./xxx.yuv";
+    char outputfilename[512] = "";
+    bool is_target_cpu       = 0;
+    bool enable_profiling    = false;
+    int ret                  = 0;
+    int width                = 1920;
+    int height               = 1080;
+    int num_levels           = IMPL_PYRAMID_MAX_LEVELS;
+    size_t in_size, out_size;
+    impl_video_format in_format;
+
+    getArgs_pyramid(argc, argv, pfilename, outputfilename, width, height, in_format, num_levels, enable_profiling,
+                    is_target_cpu);
+    void *pq = impl_common_init(is_target_cpu, enable_profiling);
+
+    FILE *input = fopen(pfilename, "rb");
+    if (input == NULL) {
+        err("input file does not exit\n");
+        return -1;
+    }
+    unsigned char *data   = impl_image_mem_alloc(pq, in_format, width, height, IMPL_MEM_TYPE_HOST, &in_size);
+    unsigned char *buf_in = impl_image_mem_alloc(pq, in_format, width, height, IMPL_MEM_TYPE_DEVICE, NULL);
+    ret                   = fread_repeat(data, 1, in_size, input, 0);
+    CHECK_IMPL(ret, "read one frame from file");
+    fclose(input);
+    impl_common_mem_copy(pq, NULL, buf_in, data, in_size, NULL, 1);
+
+    // the input is converted to every format with a single output of the multi-output CSC
+    struct impl_csc_params csc_params;
+    void *pcsc_context = NULL;
+    memset(&csc_params, 0, sizeof(csc_params));
+    csc_params.pq         = pq;
+    csc_params.is_async   = false;
+    csc_params.in_format  = in_format;
+    csc_params.out_format = in_format;
+    csc_params.width      = width;
+    csc_params.height     = height;
+    ret                   = impl_csc_init(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_init");
+
+    // all levels side by side in one surface of the source width and half its height
+    unsigned char *buf_src[IMPL_VIDEO_MAX];
+    unsigned char *buf_dst[IMPL_VIDEO_MAX];
+    for (int f = 0; f < IMPL_VIDEO_MAX; f++) {
+        impl_video_format format = (impl_video_format)f;
+        buf_src[f]               = impl_image_mem_alloc(pq, format, width, height, IMPL_MEM_TYPE_DEVICE, NULL);
+        buf_dst[f]               = impl_image_mem_alloc(pq, format, width, height / 2, IMPL_MEM_TYPE_DEVICE, NULL);
+
+        struct impl_csc_output output = {format, buf_src[f]};
+        ret                           = impl_csc_multi_run(&csc_params, pcsc_context, buf_in, &output, 1, NULL);
+        CHECK_IMPL(ret, "impl_csc_multi_run");
+    }
+
+    for (int f = 0; f < IMPL_VIDEO_MAX; f++) {
+        impl_video_format format = (impl_video_format)f;
+        struct impl_pyramid_params pyramid_params;
+        void *ppy_context = NULL;
+        memset(&pyramid_params, 0, sizeof(pyramid_params));
+        pyramid_params.pq         = pq;
+        pyramid_params.is_async   = false;
+        pyramid_params.format     = format;
+        pyramid_params.src_width  = width;
+        pyramid_params.src_height = height;
+        pyramid_params.num_levels = num_levels;
+        // every level is at most half as wide as the one before, so they fit next to each other
+        const int align_x = format == IMPL_VIDEO_V210 ? 6 : 2;
+        int level_width   = width;
+        int offset_x      = 0;
+        for (int k = 0; k < num_levels; k++) {
+            pyramid_params.levels[k].offset_x       = offset_x;
+            pyramid_params.levels[k].pitch_pixel    = width;
+            pyramid_params.levels[k].surface_height = height / 2;
+            level_width                             = level_width / 2 / align_x * align_x;
+            offset_x += level_width;
+        }
+        ret = impl_pyramid_init(&pyramid_params, ppy_context);
+        CHECK_IMPL(ret, "impl_pyramid_init");
+
+        unsigned char *buf_levels[IMPL_PYRAMID_MAX_LEVELS];
+        for (int k = 0; k < num_levels; k++)
+            buf_levels[k] = buf_dst[f];
+        std::chrono::high_resolution_clock::time_point s, e;
+        s   = std::chrono::high_resolution_clock::now();
+        ret = impl_pyramid_run(&pyramid_params, ppy_context, buf_src[f], buf_levels, NULL);
+        CHECK_IMPL(ret, "impl_pyramid_run");
+        e = std::chrono::high_resolution_clock::now();
+        info("%-16s %d levels, last %dx%d, CPU time %lfms GPU time %lfms\n", GetIMPLformatName(format), num_levels,
+             pyramid_params.levels[num_levels - 1].width, pyramid_params.levels[num_levels - 1].height,
+             std::chrono::duration<double, std::milli>(e - s).count(),
+             enable_profiling ? impl_common_event_profiling(pyramid_params.evt) / 1000000 : 0.0);
+
+        if (format == in_format && strcmp(outputfilename, "") != 0) {
+            unsigned char *buf_cpu =
+                impl_image_mem_alloc(pq, format, width, height / 2, IMPL_MEM_TYPE_HOST, &out_size);
+            impl_common_mem_copy(pq, NULL, buf_cpu, buf_dst[f], out_size, NULL, 1);
+            FILE *output = fopen(outputfilename, "wb");
+            if (output != NULL) {
+                info("levels of %dx%d written to %s\n", width, height / 2, outputfilename);
+                fwrite(buf_cpu, 1, out_size, output);
+                fclose(output);
+            }
+            impl_common_mem_free(pq, (void *)buf_cpu);
+        }
+        ret = impl_pyramid_uninit(&pyramid_params, ppy_context);
+        CHECK_IMPL(ret, "impl_pyramid_uninit");
+    }
+
+    for (int f = 0; f < IMPL_VIDEO_MAX; f++) {
+        impl_common_mem_free(pq, (void *)buf_src[f]);
+        impl_common_mem_free(pq, (void *)buf_dst[f]);
+    }
+    impl_common_mem_free(pq, (void *)data);
+    impl_common_mem_free(pq, (void *)buf_in);
+    ret = impl_csc_uninit(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_uninit");
+    impl_common_uninit(pq);
+
+    return 0;
+}
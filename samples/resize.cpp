@@ -18,7 +18,7 @@
 inline void getArgs_resize(int argc, char **argv, char *pfilename, char *poutfilename, int &frames, int &src_width,
                            int &src_height, int &dst_width, int &dst_height, impl_video_format &in_format,
                            impl_interp_mtd &interp_mtd, bool &enable_profiling, bool &is_target_cpu, bool &pre_read,
-                           bool &perfopt) {
+                           bool &perfopt, bool &fixed_point, bool &aspect_fit) {
     std::string interp_name, infile, outfile, format_name, device_name;
     ParseContext P;
 
@@ -34,6 +34,10 @@ inline void getArgs_resize(int argc, char **argv, char *pfilename, char *poutfil
     P.get("-d", "device                 set gpu(default)/cpu", &device_name, (std::string) "gpu", false);
     P.get("-pre_read", "                pre_read one frame in gpu buffer", &pre_read, (bool)false, false);
     P.get("-perfopt", "                 process frame in best performance", &perfopt, (bool)false, false);
+    P.get("-fixed", "                   Q14 fixed point interpolation, bilinear and bicubic only", &fixed_point,
+          (bool)false, false);
+    P.get("-fit", "                     keep the input aspect ratio, black bars around it", &aspect_fit, (bool)false,
+          false);
     P.check("usage:\tresize [options]\noptions:");
     in_format     = GetIMPLformat(format_name);
     is_target_cpu = getdevice(device_name);
@@ -42,8 +46,12 @@ inline void getArgs_resize(int argc, char **argv, char *pfilename, char *poutfil
         interp_mtd = IMPL_INTERP_MTD_BILINEAR;
     } else if (interp_name == "bicubic") {
         interp_mtd = IMPL_INTERP_MTD_BICUBIC;
+    } else if (interp_name == "nearest") {
+        interp_mtd = IMPL_INTERP_MTD_NEAREST;
+    } else if (interp_name == "area") {
+        interp_mtd = IMPL_INTERP_MTD_AREA;
     } else {
-        err("%s, interp_mtd is not supported (bilinear or bicubic)\n", __func__);
+        err("%s, interp_mtd is not supported (bilinear, bicubic, nearest or area)\n", __func__);
         exit(1);
     }
     if (perfopt) {
@@ -86,6 +94,8 @@ int main(int argc, char **argv) {
     bool enable_profiling  = false;
     bool pre_read          = false;
     bool perfopt           = false;
+    bool fixed_point       = false;
+    bool aspect_fit        = false;
     // Variables for recording time
     std::chrono::high_resolution_clock::time_point s, e;
     double duration_cpy  = 0.0;
@@ -96,7 +106,8 @@ int main(int argc, char **argv) {
     double gpu_time_ns0  = 0.0;
 
     getArgs_resize(argc, argv, pfilename, outputfilename, frames, src_width, src_height, dst_width, dst_height,
-                   resize_format, interp_mtd, enable_profiling, is_target_cpu, pre_read, perfopt);
+                   resize_format, interp_mtd, enable_profiling, is_target_cpu, pre_read, perfopt, fixed_point,
+                   aspect_fit);
 
     if (strcmp(outputfilename, "") != 0)
         output_file = true;
@@ -118,16 +129,24 @@ int main(int argc, char **argv) {
     buf_out = impl_image_mem_alloc(pq, resize_format, dst_width, dst_height, IMPL_MEM_TYPE_DEVICE, &out_size);
     buf_cpu = impl_image_mem_alloc(pq, resize_format, dst_width, dst_height, IMPL_MEM_TYPE_HOST, NULL);
 
+    // aspect_fit bars are black, 8 bit for i420 and nv12, 10 bit for the others
+    bool is_8bit = resize_format == IMPL_VIDEO_I420 || resize_format == IMPL_VIDEO_NV12;
+
     s = std::chrono::high_resolution_clock::now();
     memset(&resize_params, 0, sizeof(resize_params));
-    resize_params.pq         = pq;
-    resize_params.format     = resize_format;
-    resize_params.src_width  = src_width;
-    resize_params.src_height = src_height;
-    resize_params.dst_width  = dst_width;
-    resize_params.dst_height = dst_height;
-    resize_params.interp_mtd = interp_mtd;
-    ret                      = impl_resize_init(&resize_params, prs_context);
+    resize_params.pq           = pq;
+    resize_params.format       = resize_format;
+    resize_params.src_width    = src_width;
+    resize_params.src_height   = src_height;
+    resize_params.dst_width    = dst_width;
+    resize_params.dst_height   = dst_height;
+    resize_params.interp_mtd   = interp_mtd;
+    resize_params.interp_arith = fixed_point ? IMPL_INTERP_ARITH_FIXED : IMPL_INTERP_ARITH_FLOAT;
+    resize_params.aspect_fit   = aspect_fit;
+    resize_params.fill_y       = is_8bit ? 16 : 64;
+    resize_params.fill_cb      = is_8bit ? 128 : 512;
+    resize_params.fill_cr      = is_8bit ? 128 : 512;
+    ret                        = impl_resize_init(&resize_params, prs_context);
     CHECK_IMPL(ret, "impl_resize_init");
 
     e             = std::chrono::high_resolution_clock::now();
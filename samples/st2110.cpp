@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "defines.hpp"
+#include "getargs.hpp"
+#include "impl_api.h"
+#include "log.h"
+
+// RTP header 12 bytes, extended sequence number 2 bytes and a 6 byte sample row data header per line of the packet.
+// A packet holds at most one line of pgroups, so it spans two lines at most
+#define RTP_HEADER_SIZE 12
+#define SRD_HEADER_SIZE 6
+#define PKT_MAX_SRD 2
+#define PKT_HEADER_SIZE (RTP_HEADER_SIZE + 2 + SRD_HEADER_SIZE * PKT_MAX_SRD)
+
+inline void getArgs_st2110(int argc, char **argv, char *pfilename, int &width, int &height,
+                           impl_video_format &in_format, int &payload_size, bool &is_target_cpu) {
+    std::string infile, informat_name, device_name;
+    ParseContext P;
+
+    P.GetCommand(argc, argv);
+    P.get("-size", "widthXheight           set input size to [width x height]", width, height, "1920X1080", true);
+    P.get("-in_format", "input_format      set input picture format", &informat_name, (std::string) "", true);
+    P.get("-i", "input_filename            set input picture file", &infile, (std::string) "", true);
+    P.get("-payload", "bytes               pgroup payload bytes per packet", &payload_size, (int)1200, false);
+    P.get("-d", "device                    set gpu(default)/cpu", &device_name, (std::string) "gpu", false);
+    P.check("usage:\tst2110 [options]\noptions:");
+
+    in_format     = GetIMPLformat(informat_name);
+    is_target_cpu = getdevice(device_name);
+    memcpy(pfilename, infile.c_str(), infile.length() + 1);
+    info("input bitstream %s src_size %dx%d in_format %s payload %d\n ", pfilename, width, height,
+         informat_name.c_str(), payload_size);
+}
+
+// RFC 4175 headers of one packet, a sample row data header per line with the continuation bit set on all but the
+// last. The headers end at buf + PKT_HEADER_SIZE where the payload starts, returns the start of the packet
+static unsigned char *packet_write_header(unsigned char *buf, unsigned int seq, const struct impl_st2110_packet &pkt,
+                                          int payload_size, int width) {
+    int length       = pkt.length != 0 ? pkt.length : payload_size;
+    int to_eol       = (width - pkt.offset) / 2 * 5;
+    int num_srd      = length > to_eol ? 2 : 1;
+    unsigned char *p = buf + SRD_HEADER_SIZE * (PKT_MAX_SRD - num_srd);
+    memset(p, 0, RTP_HEADER_SIZE + 2);
+    p[0]  = 0x80;
+    p[1]  = 96;
+    p[2]  = (seq >> 8) & 0xff;
+    p[3]  = seq & 0xff;
+    p[12] = (seq >> 24) & 0xff;
+    p[13] = (seq >> 16) & 0xff;
+    for (int i = 0; i < num_srd; i++) {
+        unsigned char *srd = p + RTP_HEADER_SIZE + 2 + i * SRD_HEADER_SIZE;
+        int srd_length     = i == 0 ? std::min(length, to_eol) : length - to_eol;
+        int line           = pkt.line + i;
+        int offset         = i == 0 ? pkt.offset : 0;
+        srd[0]             = (srd_length >> 8) & 0xff;
+        srd[1]             = srd_length & 0xff;
+        srd[2]             = (line >> 8) & 0x7f;
+        srd[3]             = line & 0xff;
+        srd[4]             = ((offset >> 8) & 0x7f) | (i + 1 < num_srd ? 0x80 : 0);
+        srd[5]             = offset & 0xff;
+    }
+    return p;
+}
+
+// local stand-in for the network receiver, depacketizes into a contiguous yuv422ycbcr10be frame. Every sample row
+// data header is placed on its own line, data past the line end or the frame is dropped
+static void packet_sink(const unsigned char *p, unsigned char *frame, int width, int height) {
+    const unsigned char *srd = p + RTP_HEADER_SIZE + 2;
+    int num_srd              = 1;
+    while ((srd[(num_srd - 1) * SRD_HEADER_SIZE + 4] & 0x80) && num_srd < PKT_MAX_SRD)
+        num_srd++;
+    const unsigned char *payload = srd + num_srd * SRD_HEADER_SIZE;
+    for (int i = 0; i < num_srd; i++, srd += SRD_HEADER_SIZE) {
+        int length = (srd[0] << 8) | srd[1];
+        int line   = ((srd[2] & 0x7f) << 8) | srd[3];
+        int offset = ((srd[4] & 0x7f) << 8) | srd[5];
+        if (line < height && offset < width) {
+            int copy = std::min(length, (width - offset) / 2 * 5);
+            memcpy(frame + ((size_t)line * width + offset) / 2 * 5, payload, copy);
+        }
+        payload += length;
+    }
+}
+
+int main(int argc, char **argv) {
+    char pfilename[512] = "./xxx.yuv";
+    bool is_target_cpu  = 0;
+    int ret             = 0;
+    int width           = 1920;
+    int height          = 1080;
+    int payload_size    = 1200;
+    size_t in_size, out_size;
+    impl_video_format in_format;
+
+    getArgs_st2110(argc, argv, pfilename, width, height, in_format, payload_size, is_target_cpu);
+    void *pq = impl_common_init(is_target_cpu, false);
+
+    FILE *input = fopen(pfilename, "rb");
+    if (input == NULL) {
+        err("input file does not exit\n");
+        return -1;
+    }
+    unsigned char *data    = impl_image_mem_alloc(pq, in_format, width, height, IMPL_MEM_TYPE_HOST, &in_size);
+    unsigned char *buf_in  = impl_image_mem_alloc(pq, in_format, width, height, IMPL_MEM_TYPE_DEVICE, NULL);
+    unsigned char *buf_ref = impl_image_mem_alloc(pq, IMPL_VIDEO_YUV422YCBCR10BE, width, height,
+                                                  IMPL_MEM_TYPE_HOST, &out_size);
+    ret = fread_repeat(data, 1, in_size, input, 0);
+    CHECK_IMPL(ret, "read one frame from file");
+    fclose(input);
+    impl_common_mem_copy(pq, NULL, buf_in, data, in_size, NULL, 1);
+
+    // packets of whole pgroups, every packet continues where the previous one stopped
+    if (payload_size > width / 2 * 5) {
+        err("payload %d is larger than a line of %d bytes\n", payload_size, width / 2 * 5);
+        return -1;
+    }
+    int pgroups_per_packet = payload_size / 5;
+    int pgroups            = width * height / 2;
+    int num_packets        = (pgroups + pgroups_per_packet - 1) / pgroups_per_packet;
+    int packet_size        = PKT_HEADER_SIZE + payload_size;
+    unsigned char *pool =
+        (unsigned char *)impl_common_mem_alloc(pq, 1, num_packets * packet_size, IMPL_MEM_TYPE_HOST);
+    struct impl_st2110_packet *packets = (struct impl_st2110_packet *)impl_common_mem_alloc(
+        pq, 1, sizeof(struct impl_st2110_packet) * num_packets, IMPL_MEM_TYPE_SHARED);
+    for (int i = 0; i < num_packets; i++) {
+        int first         = i * pgroups_per_packet;
+        packets[i].buf    = pool + (size_t)i * packet_size;
+        packets[i].line   = first * 2 / width;
+        packets[i].offset = first * 2 % width;
+        packets[i].length = (i == num_packets - 1) ? (pgroups - first) * 5 : 0;
+    }
+    struct impl_st2110_packetizer pkt;
+    pkt.payload_size   = payload_size;
+    pkt.header_reserve = PKT_HEADER_SIZE;
+    pkt.num_packets    = num_packets;
+    pkt.packets        = packets;
+
+    struct impl_csc_params csc_params;
+    void *pcsc_context = NULL;
+    memset(&csc_params, 0, sizeof(csc_params));
+    csc_params.pq         = pq;
+    csc_params.is_async   = false;
+    csc_params.in_format  = in_format;
+    csc_params.out_format = IMPL_VIDEO_YUV422YCBCR10BE;
+    csc_params.width      = width;
+    csc_params.height     = height;
+    ret                   = impl_csc_init(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_init");
+
+    ret = impl_csc_packet_run(&csc_params, pcsc_context, buf_in, &pkt, NULL);
+    CHECK_IMPL(ret, "impl_csc_packet_run");
+    std::vector<unsigned char *> packet_start(num_packets);
+    for (int i = 0; i < num_packets; i++)
+        packet_start[i] = packet_write_header(packets[i].buf, i, packets[i], payload_size, width);
+
+    // reference frame from a single yuv422ycbcr10be output of the multi-output CSC, which any input
+    // format supports, compared with what the sink reassembles
+    unsigned char *buf_dst = impl_image_mem_alloc(pq, IMPL_VIDEO_YUV422YCBCR10BE, width, height,
+                                                  IMPL_MEM_TYPE_DEVICE, NULL);
+    struct impl_csc_output ref_output = {IMPL_VIDEO_YUV422YCBCR10BE, buf_dst};
+    ret = impl_csc_multi_run(&csc_params, pcsc_context, buf_in, &ref_output, 1, NULL);
+    CHECK_IMPL(ret, "impl_csc_multi_run");
+    impl_common_mem_copy(pq, NULL, buf_ref, buf_dst, out_size, NULL, 1);
+
+    std::vector<unsigned char> frame(out_size, 0);
+    for (int i = 0; i < num_packets; i++)
+        packet_sink(packet_start[i], frame.data(), width, height);
+    size_t mismatch = 0;
+    for (size_t i = 0; i < out_size; i++)
+        mismatch += frame[i] != buf_ref[i];
+    info("%d packets of %d bytes, %zu mismatched bytes\n", num_packets, packet_size, mismatch);
+
+    impl_common_mem_free(pq, (void *)data);
+    impl_common_mem_free(pq, (void *)buf_in);
+    impl_common_mem_free(pq, (void *)buf_dst);
+    impl_common_mem_free(pq, (void *)buf_ref);
+    impl_common_mem_free(pq, (void *)pool);
+    impl_common_mem_free(pq, (void *)packets);
+    ret = impl_csc_uninit(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_uninit");
+    impl_common_uninit(pq);
+
+    return mismatch == 0 ? 0 : -1;
+}
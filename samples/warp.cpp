@@ -0,0 +1,168 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "defines.hpp"
+#include "getargs.hpp"
+#include "impl_api.h"
+#include "log.h"
+
+inline void getArgs_warp(int argc, char **argv, char *pfilename, char *poutfilename, int &src_width,
+                         int &src_height, int &dst_width, int &dst_height, impl_video_format &in_format,
+                         float &angle, float &scale, bool &enable_profiling, bool &is_target_cpu) {
+    std::string infile, outfile, informat_name, device_name;
+    ParseContext P;
+
+    P.GetCommand(argc, argv);
+    P.get("-in_size", "widthXheight        set input size to [width x height]", src_width, src_height, "1920X1080",
+          true);
+    P.get("-out_size", "widthXheight       set output size to [width x height]", dst_width, dst_height, "1920X1080",
+          false);
+    P.get("-in_format", "input_format      set input picture format", &informat_name, (std::string) "", true);
+    P.get("-i", "input_filename            set input picture file", &infile, (std::string) "", true);
+    P.get("-o", "output_filename           set output filename of the in_format results", &outfile,
+          (std::string) "", false);
+    P.get("-angle", "degrees               rotate around the center by degrees", &angle, (float)10.0, false);
+    P.get("-scale", "s                     scale by s", &scale, (float)1.0, false);
+    P.get("-profile", "                    enable profiling, disabled by default", &enable_profiling, (bool)false,
+          false);
+    P.get("-d", "device                    set gpu(default)/cpu", &device_name, (std::string) "gpu", false);
+    P.check("usage:\twarp [options]\noptions:");
+
+    in_format     = GetIMPLformat(informat_name);
+    is_target_cpu = getdevice(device_name);
+    memcpy(pfilename, infile.c_str(), infile.length() + 1);
+    memcpy(poutfilename, outfile.c_str(), outfile.length() + 1);
+    info("input bitstream %s src_size %dx%d dst_size %dx%d in_format %s angle %f scale %f\n ", pfilename, src_width,
+         src_height, dst_width, dst_height, informat_name.c_str(), angle, scale);
+}
+
+int main(int argc, char **argv) {
+    char pfilename[512]      = "./xxx.yuv";
+    char outputfilename[512] = "";
+    bool is_target_cpu       = 0;
+    bool enable_profiling    = false;
+    int ret                  = 0;
+    int src_width            = 1920;
+    int src_height           = 1080;
+    int dst_width            = 1920;
+    int dst_height           = 1080;
+    float angle              = 10.0;
+    float scale              = 1.0;
+    FILE *output             = NULL;
+    size_t in_size, out_size;
+    impl_video_format in_format;
+    const impl_interp_mtd interp_mtds[] = {IMPL_INTERP_MTD_BILINEAR, IMPL_INTERP_MTD_BICUBIC, IMPL_INTERP_MTD_NEAREST};
+    const char *interp_names[]          = {"bilinear", "bicubic", "nearest"};
+    const int num_interp                = sizeof(interp_mtds) / sizeof(interp_mtds[0]);
+
+    getArgs_warp(argc, argv, pfilename, outputfilename, src_width, src_height, dst_width, dst_height, in_format,
+                 angle, scale, enable_profiling, is_target_cpu);
+    void *pq = impl_common_init(is_target_cpu, enable_profiling);
+
+    FILE *input = fopen(pfilename, "rb");
+    if (input == NULL) {
+        err("input file does not exit\n");
+        return -1;
+    }
+    unsigned char *data   = impl_image_mem_alloc(pq, in_format, src_width, src_height, IMPL_MEM_TYPE_HOST, &in_size);
+    unsigned char *buf_in = impl_image_mem_alloc(pq, in_format, src_width, src_height, IMPL_MEM_TYPE_DEVICE, NULL);
+    ret                   = fread_repeat(data, 1, in_size, input, 0);
+    CHECK_IMPL(ret, "read one frame from file");
+    fclose(input);
+    impl_common_mem_copy(pq, NULL, buf_in, data, in_size, NULL, 1);
+    if (strcmp(outputfilename, "") != 0)
+        output = fopen(outputfilename, "wb");
+
+    // the input is converted to every format with a single output of the multi-output CSC
+    struct impl_csc_params csc_params;
+    void *pcsc_context = NULL;
+    memset(&csc_params, 0, sizeof(csc_params));
+    csc_params.pq         = pq;
+    csc_params.is_async   = false;
+    csc_params.in_format  = in_format;
+    csc_params.out_format = in_format;
+    csc_params.width      = src_width;
+    csc_params.height     = src_height;
+    ret                   = impl_csc_init(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_init");
+
+    // rotate by angle around the source center, scale and center in the destination
+    const float rad  = angle * (float)M_PI / 180.0f;
+    const float c    = scale * cosf(rad);
+    const float n    = scale * sinf(rad);
+    const float m[6] = {c, -n, dst_width / 2.0f - c * src_width / 2.0f + n * src_height / 2.0f,
+                        n, c,  dst_height / 2.0f - n * src_width / 2.0f - c * src_height / 2.0f};
+
+    for (int f = 0; f < IMPL_VIDEO_MAX; f++) {
+        impl_video_format format = (impl_video_format)f;
+        unsigned char *buf_src   = impl_image_mem_alloc(pq, format, src_width, src_height, IMPL_MEM_TYPE_DEVICE, NULL);
+        unsigned char *buf_dst   = impl_image_mem_alloc(pq, format, dst_width, dst_height, IMPL_MEM_TYPE_DEVICE, NULL);
+
+        struct impl_csc_output csc_out = {format, buf_src};
+        ret                            = impl_csc_multi_run(&csc_params, pcsc_context, buf_in, &csc_out, 1, NULL);
+        CHECK_IMPL(ret, "impl_csc_multi_run");
+
+        for (int i = 0; i < num_interp; i++) {
+            struct impl_warp_params warp_params;
+            void *pwp_context = NULL;
+            memset(&warp_params, 0, sizeof(warp_params));
+            // black outside the source, 8 bit for i420 and nv12 and 10 bit otherwise
+            const bool is_8bit       = format == IMPL_VIDEO_I420 || format == IMPL_VIDEO_NV12;
+            warp_params.pq           = pq;
+            warp_params.is_async     = false;
+            warp_params.interp_mtd   = interp_mtds[i];
+            warp_params.format       = format;
+            warp_params.src_width    = src_width;
+            warp_params.src_height   = src_height;
+            warp_params.dst_width    = dst_width;
+            warp_params.dst_height   = dst_height;
+            warp_params.fill_y       = is_8bit ? 16 : 64;
+            warp_params.fill_cb      = is_8bit ? 128 : 512;
+            warp_params.fill_cr      = is_8bit ? 128 : 512;
+            memcpy(warp_params.matrix, m, sizeof(m));
+            ret = impl_warp_init(&warp_params, pwp_context);
+            CHECK_IMPL(ret, "impl_warp_init");
+
+            std::chrono::high_resolution_clock::time_point s, e;
+            s   = std::chrono::high_resolution_clock::now();
+            ret = impl_warp_run(&warp_params, pwp_context, buf_src, buf_dst, NULL);
+            CHECK_IMPL(ret, "impl_warp_run");
+            e = std::chrono::high_resolution_clock::now();
+            info("%-16s %-8s CPU time %lfms GPU time %lfms\n", GetIMPLformatName(format), interp_names[i],
+                 std::chrono::duration<double, std::milli>(e - s).count(),
+                 enable_profiling ? impl_common_event_profiling(warp_params.evt) / 1000000 : 0.0);
+
+            if (format == in_format && output != NULL) {
+                unsigned char *buf_cpu =
+                    impl_image_mem_alloc(pq, format, dst_width, dst_height, IMPL_MEM_TYPE_HOST, &out_size);
+                impl_common_mem_copy(pq, NULL, buf_cpu, buf_dst, out_size, NULL, 1);
+                fwrite(buf_cpu, 1, out_size, output);
+                impl_common_mem_free(pq, (void *)buf_cpu);
+            }
+            ret = impl_warp_uninit(&warp_params, pwp_context);
+            CHECK_IMPL(ret, "impl_warp_uninit");
+        }
+        impl_common_mem_free(pq, (void *)buf_src);
+        impl_common_mem_free(pq, (void *)buf_dst);
+    }
+
+    if (output != NULL) {
+        info("%d frames of %dx%d written to %s\n", num_interp, dst_width, dst_height, outputfilename);
+        fclose(output);
+    }
+    impl_common_mem_free(pq, (void *)data);
+    impl_common_mem_free(pq, (void *)buf_in);
+    ret = impl_csc_uninit(&csc_params, pcsc_context);
+    CHECK_IMPL(ret, "impl_csc_uninit");
+    impl_common_uninit(pq);
+
+    return 0;
+}
@@ -9,6 +9,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <mutex>
+#include <vector>
+
 #include "impl_api.h"
 #include "impl_csc.hpp"
 #include "impl_trace.hpp"
@@ -51,6 +54,139 @@ void *impl_common_init(bool is_target_cpu, bool enable_profiling) {
     return (void *)q0;
 }
 
+void *impl_common_init_in_order(bool is_target_cpu, bool enable_profiling) {
+    queue *q0 = NULL;
+    // profiling reads the events, so only a queue without profiling discards them
+    property_list props = enable_profiling
+                              ? property_list{property::queue::in_order(), property::queue::enable_profiling()}
+                              : property_list{property::queue::in_order(),
+                                              ext::oneapi::property::queue::discard_events()};
+    if (is_target_cpu) {
+#ifdef ONLY_FOR_GPU
+        info("%s warning:, The current library is compiled on the GPU using AOT, return "
+             "NULL\n",
+             __func__);
+#else
+        q0 = new queue(cpu_selector_v, props);
+        info("%s, Selected CPU device: %s\n", __func__, q0->get_device().get_info<info::device::name>().c_str());
+#endif
+    } else {
+        q0 = new queue(gpu_selector_v, props);
+        info("%s, Selected GPU device: %s\n", __func__, q0->get_device().get_info<info::device::name>().c_str());
+    }
+    return (void *)q0;
+}
+
+/* the CPU partitioned into equal sub-devices of cpu_slice_units compute units, so every slice has its own cores and
+ * thread pool. Non-isolated queues share a slice, every isolated queue takes one of its own. The partition lives
+ * while a queue runs on it and is dropped with its last queue by impl_common_uninit
+ */
+struct cpu_slice {
+    device dev;
+    int users;
+    bool isolated;
+};
+static std::mutex cpu_lock;
+static int cpu_slice_units  = 0;
+static context *cpu_context = NULL;
+static std::vector<cpu_slice> cpu_slices;
+
+#ifndef ONLY_FOR_GPU
+/* picks the slice of a new queue, called with cpu_lock held */
+static cpu_slice *cpu_take_slice(int num_threads, bool isolate) {
+    if (cpu_slices.empty()) {
+        device root(cpu_selector_v);
+        std::vector<device> subs =
+            root.create_sub_devices<info::partition_property::partition_equally>((size_t)num_threads);
+        if (subs.empty()) {
+            err("%s, cannot partition the CPU into sub-devices of %d compute units\n", __func__, num_threads);
+            return NULL;
+        }
+        // one context for all slices, so memory allocated on any CPU queue is valid on the others
+        cpu_context = new context(subs);
+        for (auto &sub : subs)
+            cpu_slices.push_back({sub, 0, false});
+        cpu_slice_units = num_threads;
+    } else if (num_threads != cpu_slice_units) {
+        err("%s, the CPU is partitioned into sub-devices of %d compute units while its queues run, not %d\n",
+            __func__, cpu_slice_units, num_threads);
+        return NULL;
+    }
+    if (!isolate) {
+        for (auto &slice : cpu_slices)
+            if (slice.users > 0 && !slice.isolated)
+                return &slice;
+    }
+    for (auto &slice : cpu_slices) {
+        if (slice.users == 0) {
+            slice.isolated = isolate;
+            return &slice;
+        }
+    }
+    err("%s, all %d sub-devices of %d compute units are taken\n", __func__, (int)cpu_slices.size(), num_threads);
+    return NULL;
+}
+#endif
+
+void *impl_common_init_cpu(struct impl_cpu_params *pcpu, bool enable_profiling) {
+    IMPL_ASSERT(pcpu != NULL, "cpu init failed, pcpu is null");
+#ifdef ONLY_FOR_GPU
+    info("%s warning:, The current library is compiled on the GPU using AOT, return NULL\n", __func__);
+    return NULL;
+#else
+    if (pcpu->num_threads < 0 || (pcpu->isolate && pcpu->num_threads == 0)) {
+        err("%s, Illegal cpu params: num_threads %d, isolate %d\n", __func__, pcpu->num_threads, pcpu->isolate);
+        return NULL;
+    }
+
+    queue *q0 = NULL;
+    try {
+        std::lock_guard<std::mutex> guard(cpu_lock);
+        if (pcpu->num_threads == 0) {
+            device dev(cpu_selector_v);
+            if (enable_profiling)
+                q0 = new queue(dev, property_list{property::queue::enable_profiling()});
+            else
+                q0 = new queue(dev);
+        } else {
+            cpu_slice *slice = cpu_take_slice(pcpu->num_threads, pcpu->isolate);
+            if (slice == NULL)
+                return NULL;
+            if (enable_profiling)
+                q0 = new queue(*cpu_context, slice->dev, property_list{property::queue::enable_profiling()});
+            else
+                q0 = new queue(*cpu_context, slice->dev);
+            slice->users++;
+        }
+        info("%s, Selected CPU device: %s, %d threads%s\n", __func__,
+             q0->get_device().get_info<info::device::name>().c_str(), pcpu->num_threads,
+             pcpu->isolate ? ", isolated" : "");
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        delete q0;
+        return NULL;
+    }
+    return (void *)q0;
+#endif
+}
+
+/* returns the slice of a freed CPU queue, the partition is dropped with its last queue */
+static void cpu_release_slice(const device &dev) {
+    std::lock_guard<std::mutex> guard(cpu_lock);
+    bool in_use = false;
+    for (auto &slice : cpu_slices) {
+        if (slice.users > 0 && slice.dev == dev)
+            slice.users--;
+        in_use = in_use || slice.users > 0;
+    }
+    if (!in_use && !cpu_slices.empty()) {
+        cpu_slices.clear();
+        delete cpu_context;
+        cpu_context     = NULL;
+        cpu_slice_units = 0;
+    }
+}
+
 void *impl_common_mem_alloc(void *pq, int ebytes, int num_element, impl_mem_type type) {
     unsigned char *buf_ptr = NULL;
     queue q                = *(queue *)pq;
@@ -160,12 +296,96 @@ void impl_common_mem_copy(void *pq, void *evt, void *dst, void *src, int size, v
         copy_event = q.memcpy(dst, src, size, *(event *)dep_evt);
     else
         copy_event = q.memcpy(dst, src, size);
+    if (q.has_property<ext::oneapi::property::queue::discard_events>()) {
+        if (is_sync)
+            q.wait();
+        return;
+    }
     if (is_sync)
         copy_event.wait();
     if (evt)
         *(sycl::event *)evt = copy_event;
 }
 
+IMPL_STATUS impl_common_event_join(void *pq, void *evt, void *dep_evts[], int num_evts) {
+    if (pq == NULL || evt == NULL || (dep_evts == NULL && num_evts > 0) || num_evts < 0) {
+        err("%s, queue and event must not be null, %d events to join\n", __func__, num_evts);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    // the barrier of a queue discarding events has no event to hand to another queue
+    if (impl_common_check_events(pq) != IMPL_STATUS_SUCCESS)
+        return IMPL_STATUS_INVALID_PARAMS;
+    queue q = *(queue *)pq;
+    std::vector<event> deps;
+    for (int i = 0; i < num_evts; i++)
+        if (dep_evts[i] != NULL)
+            deps.push_back(*(event *)dep_evts[i]);
+    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
+    try {
+        // a barrier with a wait list is a device side join, later commands on q may still run before it unless
+        // they depend on its event or q is in-order
+        *(event *)evt = q.ext_oneapi_submit_barrier(deps);
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        ret = IMPL_STATUS_FAIL;
+    }
+    return ret;
+}
+
+/* out-of-order queues running the completion callbacks, one per context so the callbacks can depend on the events
+ * of every queue of that context
+ */
+static std::mutex callback_lock;
+static std::vector<queue *> callback_queues;
+
+static queue callback_queue(const queue &q) {
+    std::lock_guard<std::mutex> guard(callback_lock);
+    for (queue *cq : callback_queues)
+        if (cq->get_context() == q.get_context())
+            return *cq;
+    queue *cq = new queue(q.get_context(), q.get_device());
+    callback_queues.push_back(cq);
+    return *cq;
+}
+
+void impl_common_drop_callback_queue(const context &ctx) {
+    // callbacks already submitted still run, the runtime keeps their commands alive
+    std::lock_guard<std::mutex> guard(callback_lock);
+    for (auto it = callback_queues.begin(); it != callback_queues.end(); ++it) {
+        if ((*it)->get_context() == ctx) {
+            delete *it;
+            callback_queues.erase(it);
+            return;
+        }
+    }
+}
+
+IMPL_STATUS impl_common_event_on_complete(void *pq, void *evt, impl_event_callback callback, void *user_data) {
+    if (pq == NULL || evt == NULL || callback == NULL) {
+        err("%s, queue, event and callback must not be null\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    // the event of a run on a queue discarding events is already complete
+    if (impl_common_check_events(pq) != IMPL_STATUS_SUCCESS)
+        return IMPL_STATUS_INVALID_PARAMS;
+    queue q         = *(queue *)pq;
+    event dep       = *(event *)evt;
+    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
+    try {
+        // the host task is scheduled by the runtime once dep completes, no thread waits for it. It runs on a side
+        // queue, on an in-order q every later kernel would wait for the callback to return
+        queue cq = callback_queue(q);
+        cq.submit([&](sycl::handler &h) {
+            h.depends_on(dep);
+            h.host_task([=]() { callback(user_data); });
+        });
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        ret = IMPL_STATUS_FAIL;
+    }
+    return ret;
+}
+
 void impl_common_queue_sync(void *pq) {
     IMPL_ASSERT(pq != NULL, "sync failed, queue is null");
     queue q = *(queue *)pq;
@@ -198,6 +418,43 @@ void impl_common_free_event(void *evt) {
     delete (event *)evt;
 }
 
+IMPL_STATUS impl_common_check_events(void *pq) {
+    if (pq == NULL) {
+        err("%s, queue is null\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    queue q = *(queue *)pq;
+    if (q.has_property<ext::oneapi::property::queue::discard_events>()) {
+        err("%s, the queue discards events, use a queue with events or the run without _evt\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    return IMPL_STATUS_SUCCESS;
+}
+
+/* events released by impl_common_release_event, reused by impl_common_acquire_event */
+static std::mutex event_pool_lock;
+static std::vector<event *> event_pool;
+
+void *impl_common_acquire_event() {
+    {
+        std::lock_guard<std::mutex> guard(event_pool_lock);
+        if (!event_pool.empty()) {
+            event *evt = event_pool.back();
+            event_pool.pop_back();
+            return (void *)evt;
+        }
+    }
+    return impl_common_new_event();
+}
+
+void impl_common_release_event(void *evt) {
+    IMPL_ASSERT(evt != NULL, "release event failed, event is null");
+    // drop the command the event refers to, a pooled event is a completed one
+    *(event *)evt = event();
+    std::lock_guard<std::mutex> guard(event_pool_lock);
+    event_pool.push_back((event *)evt);
+}
+
 void impl_common_event_sync(void *evt) {
     IMPL_ASSERT(evt != NULL, " event sync failed, event is null");
     event *pevent = (event *)evt;
@@ -206,5 +463,7 @@ void impl_common_event_sync(void *evt) {
 
 void impl_common_uninit(void *pq) {
     IMPL_ASSERT(pq != NULL, " queue uninit failed, queue is null");
+    impl_common_drop_callback_queue(((queue *)pq)->get_context());
+    cpu_release_slice(((queue *)pq)->get_device());
     delete (queue *)pq;
 }
@@ -2,6 +2,8 @@
  * Copyright(c) 2023 Intel Corporation
  */
 
+#pragma once
+
 #include <CL/sycl.hpp>
 
 #include "impl_api.h"
@@ -32,3 +34,43 @@ using namespace sycl;
     dst_ptr[(dst_y)*width + dst_x] = (((unsigned short)(value + (float)0.5)) << 6)
 #define dst_write_lshift6_short(dst_ptr, dst_y, dst_x, width, value)                                                   \
     dst_ptr[(dst_y)*width + dst_x] = (((unsigned short)value) << 6)
+
+/* finishes a run: its last event is stored into evt and synchronous runs wait for it. Queues created with
+ * discard_events return no usable events, evt then keeps its completed event and synchronous runs wait on the queue
+ */
+static inline void impl_common_run_done(queue &q, void *evt, sycl::event &event, bool is_async) {
+    if (q.has_property<sycl::ext::oneapi::property::queue::discard_events>()) {
+        if (!is_async)
+            q.wait();
+        return;
+    }
+    *(sycl::event *)evt = event;
+    if (!is_async)
+        event.wait();
+}
+
+/* checks that runs on pq return usable events, queues created with discard_events do not */
+IMPL_STATUS impl_common_check_events(void *pq);
+
+/* frees the queue running the completion callbacks of ctx, called when a queue of ctx is freed */
+void impl_common_drop_callback_queue(const context &ctx);
+
+/* reentrant run: runs on a copy of the params carrying a pooled event, which is returned in evt, so several frames
+ * of one context can be in flight from several threads. The filter must not change its params or context while
+ * running. Queues discarding events are rejected, the pooled event would stay a completed one
+ */
+template <typename PARAMS, typename RUN, typename... ARGS>
+static inline IMPL_STATUS impl_common_run_evt(PARAMS *p, void *&evt, RUN run, ARGS... args) {
+    evt = NULL;
+    if (impl_common_check_events(p->pq) != IMPL_STATUS_SUCCESS)
+        return IMPL_STATUS_INVALID_PARAMS;
+    PARAMS params   = *p;
+    params.evt      = impl_common_acquire_event();
+    IMPL_STATUS ret = run(&params, args...);
+    if (ret != IMPL_STATUS_SUCCESS) {
+        impl_common_release_event(params.evt);
+        params.evt = NULL;
+    }
+    evt = params.evt;
+    return ret;
+}
@@ -99,10 +99,7 @@ IMPL_STATUS impl_csc_nv12_to_yuv422ycbcr10be(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)(pcsc->evt) = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -197,10 +194,7 @@ IMPL_STATUS impl_csc_v210_to_yuv422p10le(struct impl_csc_params *pcsc, unsigned
         }
     });
 
-    *(sycl::event *)(pcsc->evt) = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -297,10 +291,7 @@ IMPL_STATUS impl_csc_v210_to_yuv422ycbcr10be(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)(pcsc->evt) = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -376,10 +367,7 @@ IMPL_STATUS impl_csc_v210_to_yuv422ycbcr10le(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)(pcsc->evt) = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -443,10 +431,7 @@ IMPL_STATUS impl_csc_v210_to_y210(struct impl_csc_params *pcsc, unsigned char *b
         }
     });
 
-    *(sycl::event *)(pcsc->evt) = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -513,10 +498,7 @@ IMPL_STATUS impl_csc_y210_to_yuv422ycbcr10be(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -579,10 +561,7 @@ IMPL_STATUS impl_csc_y210_to_yuv422p10le(struct impl_csc_params *pcsc, unsigned
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -641,10 +620,7 @@ IMPL_STATUS impl_csc_y210_to_yuv422ycbcr10le(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -720,10 +696,7 @@ IMPL_STATUS impl_csc_y210_to_v210(struct impl_csc_params *pcsc, unsigned char *b
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -786,10 +759,7 @@ IMPL_STATUS impl_csc_yuv422p10le_to_y210(struct impl_csc_params *pcsc, unsigned
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -891,10 +861,7 @@ IMPL_STATUS impl_csc_yuv422p10le_to_v210(struct impl_csc_params *pcsc, unsigned
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -963,10 +930,7 @@ IMPL_STATUS impl_csc_yuv422p10le_to_yuv422ycbcr10be(struct impl_csc_params *pcsc
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1028,10 +992,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_y210(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1120,10 +1081,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_nv12(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1236,10 +1194,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_v210(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1310,10 +1265,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_yuv422p10le(struct impl_csc_params *pcsc
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1399,10 +1351,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_yuv420p10le(struct impl_csc_params *pcsc
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1488,10 +1437,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_i420(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1577,10 +1523,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10be_to_p010(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1638,10 +1581,7 @@ IMPL_STATUS impl_csc_yuv422ycbcr10le_to_y210(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
@@ -1727,13 +1667,275 @@ IMPL_STATUS impl_csc_yuv422ycbcr10le_to_v210(struct impl_csc_params *pcsc, unsig
         }
     });
 
-    *(sycl::event *)pcsc->evt = event;
-    if (pcsc->is_async == 0) {
-        event.wait();
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
+    return ret;
+}
+
+/**
+ * Format-generic CSC, every work item unpacks one group of pixels of a row,
+ * applies the colorimetry conversion and the fused 3D LUT and packs it to the
+ * output format.
+ */
+template <impl_video_format IN_FORMAT, impl_video_format OUT_FORMAT>
+IMPL_STATUS impl_csc_generic(struct impl_csc_params *pcsc, impl_csc_context *pcontext, unsigned char *buf_in,
+                             unsigned char *buf_dst, void *dep_evt) {
+    IMPL_ASSERT(pcsc->pq != NULL, "pq is null");
+    IMPL_ASSERT(buf_in != NULL, "buf_in is null");
+    IMPL_ASSERT(buf_dst != NULL, "buf_out is null");
+    constexpr int group_width      = csc_group_width<IN_FORMAT, OUT_FORMAT>();
+    queue q                        = *(queue *)(pcsc->pq);
+    uint32_t width                 = pcsc->width;
+    uint32_t height                = pcsc->height;
+    struct csc_color_params clr    = pcontext->color;
+    struct lut3d_kernel_params lut = pcontext->lut3d;
+    IMPL_STATUS ret                = IMPL_STATUS_SUCCESS;
+    auto event                     = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            h.parallel_for(sycl::range<2>(height, width / group_width), [=](sycl::id<2> idx) {
+                const uint32_t y = idx[0];
+                const uint32_t x = idx[1] * group_width;
+                csc_pair pairs[group_width / 2];
+#pragma unroll
+                for (int i = 0; i < group_width / 2; i++) {
+                    csc_pixel<IN_FORMAT>::read_pair(buf_in, width, height, x + i * 2, y, pairs[i]);
+                    if (clr.enable)
+                        csc_color_pair(clr, pairs[i]);
+                    if (lut.enable)
+                        lut3d_apply_pair(lut, pairs[i]);
+                }
+                csc_pixel<OUT_FORMAT>::template write_group<group_width / 2>(buf_dst, width, height, x, y, pairs);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*CSC_generic_function)(struct impl_csc_params *csc_params, impl_csc_context *pcontext,
+                                            unsigned char *buf_in, unsigned char *buf_out, void *dep_evt);
+
+#define CSC_GENERIC_ROW(in)                                                                                            \
+    {                                                                                                                  \
+        impl_csc_generic<in, IMPL_VIDEO_I420>, impl_csc_generic<in, IMPL_VIDEO_V210>,                                  \
+            impl_csc_generic<in, IMPL_VIDEO_Y210>, impl_csc_generic<in, IMPL_VIDEO_NV12>,                              \
+            impl_csc_generic<in, IMPL_VIDEO_P010>, impl_csc_generic<in, IMPL_VIDEO_YUV420P10LE>,                       \
+            impl_csc_generic<in, IMPL_VIDEO_YUV422P10LE>, impl_csc_generic<in, IMPL_VIDEO_YUV422YCBCR10BE>,            \
+            impl_csc_generic<in, IMPL_VIDEO_YUV422YCBCR10LE>                                                           \
     }
+
+/* indexed by [in_format][out_format] */
+constexpr CSC_generic_function cscgenericfunction[IMPL_VIDEO_MAX][IMPL_VIDEO_MAX] = {
+    CSC_GENERIC_ROW(IMPL_VIDEO_I420),        CSC_GENERIC_ROW(IMPL_VIDEO_V210),
+    CSC_GENERIC_ROW(IMPL_VIDEO_Y210),        CSC_GENERIC_ROW(IMPL_VIDEO_NV12),
+    CSC_GENERIC_ROW(IMPL_VIDEO_P010),        CSC_GENERIC_ROW(IMPL_VIDEO_YUV420P10LE),
+    CSC_GENERIC_ROW(IMPL_VIDEO_YUV422P10LE), CSC_GENERIC_ROW(IMPL_VIDEO_YUV422YCBCR10BE),
+    CSC_GENERIC_ROW(IMPL_VIDEO_YUV422YCBCR10LE)};
+
+/* outputs of the multi-output CSC kernel, captured by value */
+struct csc_multi_outputs {
+    int num;
+    impl_video_format format[IMPL_CSC_MAX_OUTPUTS];
+    unsigned char *buf[IMPL_CSC_MAX_OUTPUTS];
+};
+
+/**
+ * Multi-output CSC, every work item unpacks one group of pixels once and
+ * packs it to each output format. GROUP_WIDTH is 6 when any output is V210.
+ */
+template <impl_video_format IN_FORMAT, int GROUP_WIDTH>
+IMPL_STATUS impl_csc_multi_generic(struct impl_csc_params *pcsc, impl_csc_context *pcontext, unsigned char *buf_in,
+                                   const struct csc_multi_outputs &outs, void *dep_evt) {
+    IMPL_ASSERT(pcsc->pq != NULL, "pq is null");
+    IMPL_ASSERT(buf_in != NULL, "buf_in is null");
+    constexpr int group_width      = GROUP_WIDTH > csc_pixel<IN_FORMAT>::group_width
+                                         ? GROUP_WIDTH
+                                         : csc_pixel<IN_FORMAT>::group_width;
+    queue q                        = *(queue *)(pcsc->pq);
+    uint32_t width                 = pcsc->width;
+    uint32_t height                = pcsc->height;
+    struct csc_color_params clr    = pcontext->color;
+    struct lut3d_kernel_params lut = pcontext->lut3d;
+    struct csc_multi_outputs dst   = outs;
+    IMPL_STATUS ret                = IMPL_STATUS_SUCCESS;
+    auto event                     = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            h.parallel_for(sycl::range<2>(height, width / group_width), [=](sycl::id<2> idx) {
+                const uint32_t y = idx[0];
+                const uint32_t x = idx[1] * group_width;
+                csc_pair pairs[group_width / 2];
+#pragma unroll
+                for (int i = 0; i < group_width / 2; i++) {
+                    csc_pixel<IN_FORMAT>::read_pair(buf_in, width, height, x + i * 2, y, pairs[i]);
+                    if (clr.enable)
+                        csc_color_pair(clr, pairs[i]);
+                    if (lut.enable)
+                        lut3d_apply_pair(lut, pairs[i]);
+                }
+                for (int k = 0; k < dst.num; k++)
+                    csc_write_group_any<group_width / 2>(dst.format[k], dst.buf[k], width, height, x, y, pairs);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
     return ret;
 }
 
+typedef IMPL_STATUS (*CSC_multi_function)(struct impl_csc_params *csc_params, impl_csc_context *pcontext,
+                                          unsigned char *buf_in, const struct csc_multi_outputs &outs,
+                                          void *dep_evt);
+
+#define CSC_MULTI_ROW(in)                                                                                              \
+    { impl_csc_multi_generic<in, 2>, impl_csc_multi_generic<in, 6> }
+
+/* indexed by [in_format][has v210 output] */
+constexpr CSC_multi_function cscmultifunction[IMPL_VIDEO_MAX][2] = {
+    CSC_MULTI_ROW(IMPL_VIDEO_I420),        CSC_MULTI_ROW(IMPL_VIDEO_V210),
+    CSC_MULTI_ROW(IMPL_VIDEO_Y210),        CSC_MULTI_ROW(IMPL_VIDEO_NV12),
+    CSC_MULTI_ROW(IMPL_VIDEO_P010),        CSC_MULTI_ROW(IMPL_VIDEO_YUV420P10LE),
+    CSC_MULTI_ROW(IMPL_VIDEO_YUV422P10LE), CSC_MULTI_ROW(IMPL_VIDEO_YUV422YCBCR10BE),
+    CSC_MULTI_ROW(IMPL_VIDEO_YUV422YCBCR10LE)};
+
+/**
+ * Scatter-gather CSC, the yuv422ycbcr10be input is gathered per pixel pair from the
+ * segments of its line.
+ */
+template <impl_video_format OUT_FORMAT>
+IMPL_STATUS impl_csc_sg(struct impl_csc_params *pcsc, impl_csc_context *pcontext, const struct sg_kernel_src &src,
+                        unsigned char *buf_dst, sycl::event &index_evt) {
+    IMPL_ASSERT(pcsc->pq != NULL, "pq is null");
+    IMPL_ASSERT(buf_dst != NULL, "buf_out is null");
+    constexpr int group_width      = csc_group_width<IMPL_VIDEO_YUV422YCBCR10BE, OUT_FORMAT>();
+    queue q                        = *(queue *)(pcsc->pq);
+    uint32_t width                 = pcsc->width;
+    uint32_t height                = pcsc->height;
+    struct sg_kernel_src sg        = src;
+    struct csc_color_params clr    = pcontext->color;
+    struct lut3d_kernel_params lut = pcontext->lut3d;
+    IMPL_STATUS ret                = IMPL_STATUS_SUCCESS;
+    auto event                     = q.submit([&](sycl::handler &h) {
+        try {
+            h.depends_on(index_evt);
+            h.parallel_for(sycl::range<2>(height, width / group_width), [=](sycl::id<2> idx) {
+                const uint32_t y = idx[0];
+                const uint32_t x = idx[1] * group_width;
+                csc_pair pairs[group_width / 2];
+#pragma unroll
+                for (int i = 0; i < group_width / 2; i++) {
+                    sg_read_pair(sg, x + i * 2, y, pairs[i]);
+                    if (clr.enable)
+                        csc_color_pair(clr, pairs[i]);
+                    if (lut.enable)
+                        lut3d_apply_pair(lut, pairs[i]);
+                }
+                csc_pixel<OUT_FORMAT>::template write_group<group_width / 2>(buf_dst, width, height, x, y, pairs);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*CSC_sg_function)(struct impl_csc_params *csc_params, impl_csc_context *pcontext,
+                                       const struct sg_kernel_src &src, unsigned char *buf_out,
+                                       sycl::event &index_evt);
+
+constexpr CSC_sg_function cscsgfunction[IMPL_VIDEO_MAX] = {impl_csc_sg<IMPL_VIDEO_I420>,
+                                                           impl_csc_sg<IMPL_VIDEO_V210>,
+                                                           impl_csc_sg<IMPL_VIDEO_Y210>,
+                                                           impl_csc_sg<IMPL_VIDEO_NV12>,
+                                                           impl_csc_sg<IMPL_VIDEO_P010>,
+                                                           impl_csc_sg<IMPL_VIDEO_YUV420P10LE>,
+                                                           impl_csc_sg<IMPL_VIDEO_YUV422P10LE>,
+                                                           impl_csc_sg<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                           impl_csc_sg<IMPL_VIDEO_YUV422YCBCR10LE>};
+
+/**
+ * Packetized CSC, every work item converts one pixel pair and writes it as a
+ * pgroup into its packet payload.
+ */
+template <impl_video_format IN_FORMAT>
+IMPL_STATUS impl_csc_packetize(struct impl_csc_params *pcsc, impl_csc_context *pcontext, unsigned char *buf_in,
+                               const struct impl_st2110_packetizer &pkt, void *dep_evt) {
+    IMPL_ASSERT(pcsc->pq != NULL, "pq is null");
+    IMPL_ASSERT(buf_in != NULL, "buf_in is null");
+    queue q                             = *(queue *)(pcsc->pq);
+    uint32_t width                      = pcsc->width;
+    uint32_t height                     = pcsc->height;
+    uint32_t pgroups                    = pkt.payload_size / 5;
+    uint32_t reserve                    = pkt.header_reserve;
+    const struct impl_st2110_packet *pk = pkt.packets;
+    struct csc_color_params clr         = pcontext->color;
+    struct lut3d_kernel_params lut      = pcontext->lut3d;
+    IMPL_STATUS ret                     = IMPL_STATUS_SUCCESS;
+    auto event                          = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            h.parallel_for(sycl::range<2>(pkt.num_packets, pgroups), [=](sycl::id<2> idx) {
+                const struct impl_st2110_packet packet = pk[idx[0]];
+                const uint32_t pg                      = idx[1];
+                if (packet.length != 0 && pg >= (uint32_t)packet.length / 5)
+                    return;
+                // pgroups past the end of the line continue on the next line
+                const uint32_t pos = packet.offset + pg * 2;
+                const uint32_t y   = packet.line + pos / width;
+                const uint32_t x   = pos % width;
+                if (y >= height)
+                    return;
+                csc_pair pair;
+                csc_pixel<IN_FORMAT>::read_pair(buf_in, width, height, x, y, pair);
+                if (clr.enable)
+                    csc_color_pair(clr, pair);
+                if (lut.enable)
+                    lut3d_apply_pair(lut, pair);
+                csc_pack_ycbcr10be::pack_pgroup(packet.buf + reserve + pg * 5, pair);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, pcsc->evt, event, pcsc->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*CSC_packet_function)(struct impl_csc_params *csc_params, impl_csc_context *pcontext,
+                                           unsigned char *buf_in, const struct impl_st2110_packetizer &pkt,
+                                           void *dep_evt);
+
+constexpr CSC_packet_function cscpacketfunction[IMPL_VIDEO_MAX] = {impl_csc_packetize<IMPL_VIDEO_I420>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_V210>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_Y210>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_NV12>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_P010>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_YUV420P10LE>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_YUV422P10LE>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                                   impl_csc_packetize<IMPL_VIDEO_YUV422YCBCR10LE>};
+
 enum CSC_function_index {
     index_y210_to_v210 = 0,
     index_v210_to_y210,
@@ -1783,6 +1985,25 @@ CSC_function cscfunction[MAX_CSC_FUNCTION_NUM] = {impl_csc_y210_to_v210,
                                                   impl_csc_yuv422ycbcr10le_to_y210,
                                                   impl_csc_y210_to_yuv422ycbcr10le};
 
+/* selects the generic kernel, which supports any format pair, colorimetry conversion and 3D LUT */
+static IMPL_STATUS csc_generic_init(struct impl_csc_params *pcsc, impl_csc_context *pcontext) {
+    if (pcsc->in_format < 0 || pcsc->in_format >= IMPL_VIDEO_MAX || pcsc->out_format < 0 ||
+        pcsc->out_format >= IMPL_VIDEO_MAX) {
+        err("%s unsuported format %d to %d\n", __func__, pcsc->in_format, pcsc->out_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((pcsc->width % 2) != 0 || (pcsc->height % 2) != 0) {
+        err("%s, Illegal size: The width and height must be a multiple of 2\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((pcsc->in_format == IMPL_VIDEO_V210 || pcsc->out_format == IMPL_VIDEO_V210) && (pcsc->width % 48) != 0) {
+        err("%s, Illegal V210 size: The width must be a multiple of 48\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    pcontext->is_generic = true;
+    return IMPL_STATUS_SUCCESS;
+}
+
 IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_context) {
     IMPL_ASSERT(pcsc != NULL, "csc init failed, pcsc is null");
     IMPL_STATUS ret            = IMPL_STATUS_SUCCESS;
@@ -1791,6 +2012,14 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
     memset(pcontext, 0, sizeof(impl_csc_context));
     pcsc_context = (void *)pcontext;
 
+    ret = impl_csc_color_init(pcsc, &pcontext->color);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    if (pcsc->lut3d_context != NULL)
+        pcontext->lut3d = ((struct impl_lut3d_context *)pcsc->lut3d_context)->kparams;
+    if (pcontext->color.enable || pcontext->lut3d.enable)
+        return csc_generic_init(pcsc, pcontext);
+
     if (pcsc->in_format == IMPL_VIDEO_YUV422YCBCR10BE) {
         switch (pcsc->out_format) {
         case IMPL_VIDEO_YUV422P10LE:
@@ -1818,8 +2047,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_yuv422ycbcr10be_to_p010;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
     } else if (pcsc->in_format == IMPL_VIDEO_YUV422YCBCR10LE) {
@@ -1837,8 +2065,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_yuv422ycbcr10le_to_y210;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
     } else if (pcsc->in_format == IMPL_VIDEO_YUV422P10LE) {
@@ -1859,8 +2086,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_yuv422p10le_to_y210;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
     } else if (pcsc->in_format == IMPL_VIDEO_NV12) {
@@ -1869,8 +2095,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_nv12_to_yuv422ycbcr10be;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
     } else if (pcsc->in_format == IMPL_VIDEO_V210) {
@@ -1894,8 +2119,7 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_v210_to_y210;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
     } else if (pcsc->in_format == IMPL_VIDEO_Y210) {
@@ -1919,10 +2143,11 @@ IMPL_API IMPL_STATUS impl_csc_init(struct impl_csc_params *pcsc, void *&pcsc_con
             pcontext->csc_func_index = index_y210_to_v210;
             break;
         default:
-            err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
-            ret = IMPL_STATUS_INVALID_PARAMS;
+            pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
             break;
         }
+    } else if (pcsc->in_format >= 0 && pcsc->in_format < IMPL_VIDEO_MAX) {
+        pcontext->csc_func_index = MAX_CSC_FUNCTION_NUM;
     } else {
         err("%s unsuported input format %d\n", __func__, pcsc->in_format);
         ret = IMPL_STATUS_INVALID_PARAMS;
@@ -1935,6 +2160,8 @@ IMPL_STATUS impl_csc_uninit(struct impl_csc_params *pcsc, void *pcsc_context) {
     IMPL_ASSERT(pcsc_context != NULL, "csc uninit failed, pcsc_context is null");
     delete (event *)pcsc->evt;
     struct impl_csc_context *pcontext = (struct impl_csc_context *)pcsc_context;
+    impl_csc_color_uninit(pcsc->pq, &pcontext->color);
+    impl_sg_free(pcsc->pq, pcontext->sg_index);
     delete pcontext;
     return IMPL_STATUS_SUCCESS;
 }
@@ -1945,7 +2172,135 @@ IMPL_STATUS impl_csc_run(struct impl_csc_params *pcsc, void *pcsc_context, unsig
     IMPL_ASSERT(pcsc_context != NULL, "csc uninit failed, pcsc_context is null");
     IMPL_STATUS ret                   = IMPL_STATUS_SUCCESS;
     struct impl_csc_context *pcontext = (struct impl_csc_context *)pcsc_context;
-    ret                               = cscfunction[pcontext->csc_func_index](pcsc, buf_in, buf_dst, dep_evt);
+    if (pcontext->is_generic) {
+        ret = cscgenericfunction[pcsc->in_format][pcsc->out_format](pcsc, pcontext, buf_in, buf_dst, dep_evt);
+    } else if (pcontext->csc_func_index == MAX_CSC_FUNCTION_NUM) {
+        err("%s unsuported output format %d for input %d\n", __func__, pcsc->out_format, pcsc->in_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    } else {
+        ret = cscfunction[pcontext->csc_func_index](pcsc, buf_in, buf_dst, dep_evt);
+    }
     IMPL_ASSERT(ret >= 0, "csc_function failed");
     return ret;
 }
+
+IMPL_STATUS impl_csc_run_evt(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                             unsigned char *buf_dst, void *dep_evt, void *&evt) {
+    IMPL_ASSERT(pcsc != NULL, "csc run failed, pcsc is null");
+    return impl_common_run_evt(pcsc, evt, impl_csc_run, pcsc_context, buf_in, buf_dst, dep_evt);
+}
+
+IMPL_STATUS impl_csc_multi_run(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                               struct impl_csc_output *outputs, int num_outputs, void *dep_evt) {
+    IMPL_ASSERT(pcsc != NULL, "csc multi run fail, pcsc is null");
+    IMPL_ASSERT(pcsc_context != NULL, "csc multi run failed, pcsc_context is null");
+    struct impl_csc_context *pcontext = (struct impl_csc_context *)pcsc_context;
+    struct csc_multi_outputs outs;
+    bool has_v210 = pcsc->in_format == IMPL_VIDEO_V210;
+
+    if (outputs == NULL || num_outputs < 1 || num_outputs > IMPL_CSC_MAX_OUTPUTS) {
+        err("%s, invalid outputs number %d\n", __func__, num_outputs);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pcsc->in_format < 0 || pcsc->in_format >= IMPL_VIDEO_MAX) {
+        err("%s unsuported input format %d\n", __func__, pcsc->in_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    outs.num = num_outputs;
+    for (int i = 0; i < num_outputs; i++) {
+        if (outputs[i].format < 0 || outputs[i].format >= IMPL_VIDEO_MAX || outputs[i].buf == NULL) {
+            err("%s, invalid output %d format %d\n", __func__, i, outputs[i].format);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+        outs.format[i] = outputs[i].format;
+        outs.buf[i]    = outputs[i].buf;
+        has_v210 |= outputs[i].format == IMPL_VIDEO_V210;
+    }
+    if ((pcsc->width % 2) != 0 || (pcsc->height % 2) != 0 || (has_v210 && (pcsc->width % 48) != 0)) {
+        err("%s, Illegal size: The width and height must be a multiple of 2, and the width a multiple of 48 for "
+            "V210\n",
+            __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    IMPL_STATUS ret = cscmultifunction[pcsc->in_format][has_v210 ? 1 : 0](pcsc, pcontext, buf_in, outs, dep_evt);
+    IMPL_ASSERT(ret >= 0, "csc_multi_function failed");
+    return ret;
+}
+
+IMPL_STATUS impl_csc_packet_run(struct impl_csc_params *pcsc, void *pcsc_context, unsigned char *buf_in,
+                                struct impl_st2110_packetizer *ppkt, void *dep_evt) {
+    IMPL_ASSERT(pcsc != NULL, "csc packet run fail, pcsc is null");
+    IMPL_ASSERT(pcsc_context != NULL, "csc packet run failed, pcsc_context is null");
+    struct impl_csc_context *pcontext = (struct impl_csc_context *)pcsc_context;
+
+    if (ppkt == NULL || ppkt->packets == NULL || ppkt->num_packets < 1) {
+        err("%s, invalid packetization descriptor\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (ppkt->payload_size < 5 || (ppkt->payload_size % 5) != 0 || ppkt->header_reserve < 0) {
+        err("%s, payload_size %d must be a multiple of 5, header_reserve %d\n", __func__, ppkt->payload_size,
+            ppkt->header_reserve);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pcsc->in_format < 0 || pcsc->in_format >= IMPL_VIDEO_MAX) {
+        err("%s unsuported input format %d\n", __func__, pcsc->in_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((pcsc->width % 2) != 0 || (pcsc->height % 2) != 0 ||
+        (pcsc->in_format == IMPL_VIDEO_V210 && (pcsc->width % 48) != 0)) {
+        err("%s, Illegal size: The width and height must be a multiple of 2, and the width a multiple of 48 for "
+            "V210\n",
+            __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    for (int i = 0; i < ppkt->num_packets; i++) {
+        const struct impl_st2110_packet &pk = ppkt->packets[i];
+        if (pk.buf == NULL || pk.length < 0 || pk.length > ppkt->payload_size || (pk.length % 5) != 0 ||
+            pk.offset < 0 || pk.offset >= pcsc->width || (pk.offset % 2) != 0 || pk.line < 0 ||
+            pk.line >= pcsc->height) {
+            err("%s, invalid packet %d: line %d, offset %d, length %d\n", __func__, i, pk.line, pk.offset,
+                pk.length);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+    }
+
+    IMPL_STATUS ret = cscpacketfunction[pcsc->in_format](pcsc, pcontext, buf_in, *ppkt, dep_evt);
+    IMPL_ASSERT(ret >= 0, "csc_packet_function failed");
+    return ret;
+}
+
+IMPL_STATUS impl_csc_sg_run(struct impl_csc_params *pcsc, void *pcsc_context, struct impl_sg_input *pin,
+                            unsigned char *buf_dst, void *dep_evt) {
+    IMPL_ASSERT(pcsc != NULL, "csc sg run fail, pcsc is null");
+    IMPL_ASSERT(pcsc_context != NULL, "csc sg run failed, pcsc_context is null");
+    struct impl_csc_context *pcontext = (struct impl_csc_context *)pcsc_context;
+
+    if (pcsc->in_format != IMPL_VIDEO_YUV422YCBCR10BE) {
+        err("%s, scatter-gather input must be yuv422ycbcr10be, got %d\n", __func__, pcsc->in_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pcsc->out_format < 0 || pcsc->out_format >= IMPL_VIDEO_MAX) {
+        err("%s unsuported output format %d\n", __func__, pcsc->out_format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((pcsc->height % 2) != 0 || (pcsc->out_format == IMPL_VIDEO_V210 && (pcsc->width % 48) != 0)) {
+        err("%s, Illegal size: The height must be a multiple of 2, and the width a multiple of 48 for V210\n",
+            __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    IMPL_STATUS ret = impl_sg_check(pin, pcsc->width, pcsc->height);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+
+    struct sg_kernel_src src;
+    sycl::event index_evt;
+    ret = impl_sg_index(pcsc->pq, pin, pcsc->width, pcsc->height, pcontext->sg_index, src, dep_evt, index_evt);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    ret = cscsgfunction[pcsc->out_format](pcsc, pcontext, src, buf_dst, index_evt);
+    IMPL_ASSERT(ret >= 0, "csc_sg_function failed");
+    impl_sg_gathered(pcsc->pq, pcontext->sg_index, pcsc->evt);
+    return ret;
+}
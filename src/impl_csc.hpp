@@ -6,10 +6,21 @@
 #define __IMPL_CSC_HPP__
 
 #include "impl_common.hpp"
+#include "impl_csc_color.hpp"
+#include "impl_lut3d.hpp"
+#include "impl_sg.hpp"
 
 struct impl_csc_context {
-    /** IMPL CSC function index */
+    /** IMPL CSC function index, MAX_CSC_FUNCTION_NUM when impl_csc_run has no kernel for the pair */
     int csc_func_index;
+    /** use the format-generic CSC kernel instead of csc_func_index */
+    bool is_generic;
+    /** colorimetry conversion applied by the generic CSC kernel */
+    struct csc_color_params color;
+    /** 3D LUT applied by the generic CSC kernel after colorimetry conversion */
+    struct lut3d_kernel_params lut3d;
+    /** per line segment index of the scatter-gather input */
+    struct sg_index sg_index;
 };
 
 /**
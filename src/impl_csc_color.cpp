@@ -0,0 +1,219 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_csc_color.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
+#include "impl_api.h"
+#include "impl_trace.hpp"
+
+/* reference white in cd/m2, linear light 1.0 */
+#define CSC_COLOR_REF_WHITE 203.0
+/* nominal peak of an HLG display */
+#define CSC_COLOR_HLG_PEAK 1000.0
+/* tone mapping keeps linear light below knee * destination peak untouched */
+#define CSC_COLOR_KNEE 0.8
+
+static const double pq_m1 = 2610.0 / 16384.0;
+static const double pq_m2 = 2523.0 / 4096.0 * 128.0;
+static const double pq_c1 = 3424.0 / 4096.0;
+static const double pq_c2 = 2413.0 / 4096.0 * 32.0;
+static const double pq_c3 = 2392.0 / 4096.0 * 32.0;
+
+static const double hlg_a = 0.17883277;
+static const double hlg_b = 0.28466892;
+static const double hlg_c = 0.55991073;
+
+/* BT.2087 / BT.2407 linear light RGB conversion */
+static const double gamut_709_to_2020[9] = {0.6274, 0.3293, 0.0433, 0.0691, 0.9195, 0.0114, 0.0164, 0.0880, 0.8956};
+static const double gamut_2020_to_709[9] = {1.6605, -0.5876, -0.0728, -0.1246, 1.1329,
+                                            -0.0083, -0.0182, -0.1006, 1.1187};
+
+static double color_peak(impl_color_trc trc) {
+    switch (trc) {
+    case IMPL_COLOR_TRC_PQ:
+        return 10000.0 / CSC_COLOR_REF_WHITE;
+    case IMPL_COLOR_TRC_HLG:
+        return CSC_COLOR_HLG_PEAK / CSC_COLOR_REF_WHITE;
+    default:
+        return 1.0;
+    }
+}
+
+static double color_to_linear(impl_color_trc trc, double v) {
+    switch (trc) {
+    case IMPL_COLOR_TRC_PQ: {
+        double p = pow(v, 1.0 / pq_m2);
+        return pow(fmax(p - pq_c1, 0.0) / (pq_c2 - pq_c3 * p), 1.0 / pq_m1) * 10000.0 / CSC_COLOR_REF_WHITE;
+    }
+    case IMPL_COLOR_TRC_HLG: {
+        // inverse OETF then a per channel approximation of the 1000 cd/m2 OOTF (gamma 1.2)
+        double e = v <= 0.5 ? v * v / 3.0 : (exp((v - hlg_c) / hlg_a) + hlg_b) / 12.0;
+        return pow(e, 1.2) * CSC_COLOR_HLG_PEAK / CSC_COLOR_REF_WHITE;
+    }
+    default:
+        return v < 0.081 ? v / 4.5 : pow((v + 0.099) / 1.099, 1.0 / 0.45);
+    }
+}
+
+static double color_from_linear(impl_color_trc trc, double l) {
+    l = fmin(fmax(l, 0.0), color_peak(trc));
+    switch (trc) {
+    case IMPL_COLOR_TRC_PQ: {
+        double p = pow(l * CSC_COLOR_REF_WHITE / 10000.0, pq_m1);
+        return pow((pq_c1 + pq_c2 * p) / (1.0 + pq_c3 * p), pq_m2);
+    }
+    case IMPL_COLOR_TRC_HLG: {
+        double e = pow(l * CSC_COLOR_REF_WHITE / CSC_COLOR_HLG_PEAK, 1.0 / 1.2);
+        return e <= 1.0 / 12.0 ? sqrt(3.0 * e) : hlg_a * log(12.0 * e - hlg_b) + hlg_c;
+    }
+    default:
+        return l < 0.018 ? 4.5 * l : 1.099 * pow(l, 0.45) - 0.099;
+    }
+}
+
+/* knee plus extended Reinhard shoulder, maps [0, src_peak] into [0, dst_peak] */
+static double color_tone_map(double l, double src_peak, double dst_peak) {
+    double knee = CSC_COLOR_KNEE * dst_peak;
+    if (src_peak <= dst_peak || l <= knee)
+        return l;
+    double x = (l - knee) / (dst_peak - knee);
+    double w = (src_peak - knee) / (dst_peak - knee);
+    double y = x * (1.0 + x / (w * w)) / (1.0 + x);
+    return knee + fmin(y, 1.0) * (dst_peak - knee);
+}
+
+void impl_csc_ycbcr_init(struct csc_ycbcr *q, impl_color_primaries primaries, impl_color_range range) {
+    bool full = range == IMPL_COLOR_RANGE_FULL;
+    if (primaries == IMPL_COLOR_PRIMARIES_BT2020) {
+        q->kr = 0.2627f;
+        q->kb = 0.0593f;
+    } else {
+        q->kr = 0.2126f;
+        q->kb = 0.0722f;
+    }
+    q->y_offset = full ? 0.0f : 64.0f;
+    q->y_scale  = full ? 1023.0f : 876.0f;
+    q->c_scale  = full ? 1023.0f : 896.0f;
+    // keep the SDI timing reference codes free in limited range
+    q->code_min = full ? 0.0f : 4.0f;
+    q->code_max = full ? 1023.0f : 1019.0f;
+    // reciprocals and matrix entries are precomputed so the kernels only multiply
+    q->inv_y_scale = 1.0f / q->y_scale;
+    q->inv_c_scale = 1.0f / q->c_scale;
+    q->kg          = 1.0f - q->kr - q->kb;
+    q->cr_r        = 2.0f * (1.0f - q->kr);
+    q->cb_b        = 2.0f * (1.0f - q->kb);
+    q->cb_g        = -2.0f * (1.0f - q->kb) * q->kb / q->kg;
+    q->cr_g        = -2.0f * (1.0f - q->kr) * q->kr / q->kg;
+    q->cb_scale    = 0.5f / (1.0f - q->kb);
+    q->cr_scale    = 0.5f / (1.0f - q->kr);
+}
+
+static void color_resolve(struct impl_colorimetry &dst, const struct impl_colorimetry &src) {
+    if (dst.primaries == IMPL_COLOR_PRIMARIES_UNSPECIFIED)
+        dst.primaries = src.primaries;
+    if (dst.trc == IMPL_COLOR_TRC_UNSPECIFIED)
+        dst.trc = src.trc;
+    if (dst.range == IMPL_COLOR_RANGE_UNSPECIFIED)
+        dst.range = src.range;
+}
+
+static bool color_valid(const struct impl_colorimetry &c) {
+    return c.primaries >= 0 && c.primaries < IMPL_COLOR_PRIMARIES_MAX && c.trc >= 0 && c.trc < IMPL_COLOR_TRC_MAX &&
+           c.range >= 0 && c.range < IMPL_COLOR_RANGE_MAX;
+}
+
+IMPL_STATUS impl_csc_color_init(struct impl_csc_params *pcsc, struct csc_color_params *pcolor) {
+    IMPL_ASSERT(pcsc != NULL, "pcsc is null");
+    IMPL_ASSERT(pcolor != NULL, "pcolor is null");
+    memset(pcolor, 0, sizeof(struct csc_color_params));
+
+    if (!color_valid(pcsc->src_color) || !color_valid(pcsc->dst_color)) {
+        err("%s, invalid colorimetry\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    const struct impl_colorimetry defaults = {IMPL_COLOR_PRIMARIES_BT709, IMPL_COLOR_TRC_BT709,
+                                              IMPL_COLOR_RANGE_LIMITED};
+    struct impl_colorimetry src            = pcsc->src_color;
+    struct impl_colorimetry dst            = pcsc->dst_color;
+    color_resolve(dst, src);
+    color_resolve(src, defaults);
+    color_resolve(dst, defaults);
+    if (src.primaries == dst.primaries && src.trc == dst.trc && src.range == dst.range)
+        return IMPL_STATUS_SUCCESS;
+
+    impl_csc_ycbcr_init(&pcolor->in, src.primaries, src.range);
+    impl_csc_ycbcr_init(&pcolor->out, dst.primaries, dst.range);
+    pcolor->enable      = 1;
+    pcolor->skip_linear = src.primaries == dst.primaries && src.trc == dst.trc;
+    if (pcolor->skip_linear)
+        return IMPL_STATUS_SUCCESS;
+
+    const double *gamut = NULL;
+    if (src.primaries == IMPL_COLOR_PRIMARIES_BT709 && dst.primaries == IMPL_COLOR_PRIMARIES_BT2020)
+        gamut = gamut_709_to_2020;
+    else if (src.primaries == IMPL_COLOR_PRIMARIES_BT2020 && dst.primaries == IMPL_COLOR_PRIMARIES_BT709)
+        gamut = gamut_2020_to_709;
+    double gain = 1.0;
+    for (int i = 0; i < 3; i++) {
+        double row = 0.0;
+        for (int j = 0; j < 3; j++) {
+            pcolor->gamut[i * 3 + j] = gamut ? gamut[i * 3 + j] : (i == j ? 1.0 : 0.0);
+            row += fabs(pcolor->gamut[i * 3 + j]);
+        }
+        gain = fmax(gain, row);
+    }
+
+    // the output LUT covers the largest linear value the gamut matrix can produce
+    double src_peak       = color_peak(src.trc) * gain;
+    double dst_peak       = color_peak(dst.trc);
+    pcolor->lut_out_range = src_peak;
+
+    std::vector<float> lut_in(CSC_COLOR_LUT_IN_SIZE);
+    std::vector<float> lut_out(CSC_COLOR_LUT_OUT_SIZE);
+    for (int i = 0; i < CSC_COLOR_LUT_IN_SIZE; i++)
+        lut_in[i] = color_to_linear(src.trc, (double)i / (CSC_COLOR_LUT_IN_SIZE - 1));
+    for (int i = 0; i < CSC_COLOR_LUT_OUT_SIZE; i++) {
+        double s   = (double)i / (CSC_COLOR_LUT_OUT_SIZE - 1);
+        lut_out[i] = color_from_linear(dst.trc, color_tone_map(s * s * src_peak, src_peak, dst_peak));
+    }
+
+    queue q = *(queue *)(pcsc->pq);
+    try {
+        pcolor->lut_in  = sycl::malloc_device<float>(CSC_COLOR_LUT_IN_SIZE, q);
+        pcolor->lut_out = sycl::malloc_device<float>(CSC_COLOR_LUT_OUT_SIZE, q);
+        if (pcolor->lut_in == NULL || pcolor->lut_out == NULL) {
+            err("%s, colorimetry LUT allocation failed\n", __func__);
+            impl_csc_color_uninit(pcsc->pq, pcolor);
+            return IMPL_STATUS_FAIL;
+        }
+        q.memcpy(pcolor->lut_in, lut_in.data(), CSC_COLOR_LUT_IN_SIZE * sizeof(float));
+        q.memcpy(pcolor->lut_out, lut_out.data(), CSC_COLOR_LUT_OUT_SIZE * sizeof(float));
+        q.wait();
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        impl_csc_color_uninit(pcsc->pq, pcolor);
+        return IMPL_STATUS_FAIL;
+    }
+    dbg("%s, colorimetry %d/%d/%d -> %d/%d/%d\n", __func__, src.primaries, src.trc, src.range, dst.primaries,
+        dst.trc, dst.range);
+    return IMPL_STATUS_SUCCESS;
+}
+
+void impl_csc_color_uninit(void *pq, struct csc_color_params *pcolor) {
+    queue q = *(queue *)pq;
+    if (pcolor->lut_in != NULL)
+        sycl::free(pcolor->lut_in, q);
+    if (pcolor->lut_out != NULL)
+        sycl::free(pcolor->lut_out, q);
+    pcolor->lut_in  = NULL;
+    pcolor->lut_out = NULL;
+    pcolor->enable  = 0;
+}
@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_CSC_COLOR_HPP__
+#define __IMPL_CSC_COLOR_HPP__
+
+#include "impl_common.hpp"
+#include "impl_csc_pixel.hpp"
+
+/** input transfer LUT entries, indexed by normalized R'G'B' */
+#define CSC_COLOR_LUT_IN_SIZE 1025
+/** output transfer LUT entries, indexed by sqrt of normalized linear light */
+#define CSC_COLOR_LUT_OUT_SIZE 4097
+
+/**
+ * Y'CbCr quantization and luma coefficients of one side of a conversion,
+ * code = Y' * y_scale + y_offset, code = C * c_scale + 512.
+ */
+struct csc_ycbcr {
+    float y_offset;
+    float y_scale;
+    float c_scale;
+    float kr;
+    float kb;
+    /** codes written are clamped to [code_min, code_max] */
+    float code_min;
+    float code_max;
+    /** code to normalized Y'CbCr: (code - offset) * inv_scale */
+    float inv_y_scale;
+    float inv_c_scale;
+    /** Y'CbCr to R'G'B': R = Y + cr_r * Cr, G = Y + cb_g * Cb + cr_g * Cr, B = Y + cb_b * Cb */
+    float cr_r;
+    float cb_g;
+    float cr_g;
+    float cb_b;
+    /** R'G'B' to Y'CbCr: Cb = (B - Y) * cb_scale, Cr = (R - Y) * cr_scale */
+    float kg;
+    float cb_scale;
+    float cr_scale;
+};
+
+/**
+ * Colorimetry conversion parameters, built on host by impl_csc_color_init and
+ * passed by value into the CSC kernels. Linear light is relative to the
+ * 203 cd/m2 HDR reference white, which is also SDR peak white.
+ */
+struct csc_color_params {
+    /** colorimetry conversion enabled */
+    int enable;
+    /** source Y'CbCr */
+    struct csc_ycbcr in;
+    /** destination Y'CbCr */
+    struct csc_ycbcr out;
+    /** linear light stage is skipped when transfer and primaries are unchanged */
+    int skip_linear;
+    /** linear light gamut conversion matrix, row major */
+    float gamut[9];
+    /** device LUT, normalized R'G'B' to linear light */
+    float *lut_in;
+    /** device LUT, sqrt(linear / lut_out_range) to destination R'G'B', tone mapping included */
+    float *lut_out;
+    /** linear light covered by lut_out */
+    float lut_out_range;
+};
+
+static inline float csc_color_lut(const float *lut, int size, float v) {
+    float pos = sycl::clamp(v, 0.0f, 1.0f) * (float)(size - 1);
+    int idx   = sycl::min((int)pos, size - 2);
+    float w   = pos - (float)idx;
+    return lut[idx] + w * (lut[idx + 1] - lut[idx]);
+}
+
+/* one pixel R'G'B' in source transfer to R'G'B' in destination transfer */
+static inline void csc_color_rgb(const struct csc_color_params &c, float &r, float &g, float &b) {
+    float lr = csc_color_lut(c.lut_in, CSC_COLOR_LUT_IN_SIZE, r);
+    float lg = csc_color_lut(c.lut_in, CSC_COLOR_LUT_IN_SIZE, g);
+    float lb = csc_color_lut(c.lut_in, CSC_COLOR_LUT_IN_SIZE, b);
+
+    // out of gamut colours are clipped to zero in linear light
+    float tr = sycl::max(c.gamut[0] * lr + c.gamut[1] * lg + c.gamut[2] * lb, 0.0f);
+    float tg = sycl::max(c.gamut[3] * lr + c.gamut[4] * lg + c.gamut[5] * lb, 0.0f);
+    float tb = sycl::max(c.gamut[6] * lr + c.gamut[7] * lg + c.gamut[8] * lb, 0.0f);
+
+    float inv_range = 1.0f / c.lut_out_range;
+    r               = csc_color_lut(c.lut_out, CSC_COLOR_LUT_OUT_SIZE, sycl::sqrt(tr * inv_range));
+    g               = csc_color_lut(c.lut_out, CSC_COLOR_LUT_OUT_SIZE, sycl::sqrt(tg * inv_range));
+    b               = csc_color_lut(c.lut_out, CSC_COLOR_LUT_OUT_SIZE, sycl::sqrt(tb * inv_range));
+}
+
+static inline unsigned short csc_ycbcr_quantize(const struct csc_ycbcr &q, float v, float scale, float offset) {
+    return (unsigned short)sycl::clamp(v * scale + offset + 0.5f, q.code_min, q.code_max);
+}
+
+/**
+ * Convert both pixels of a pair to R'G'B', run op(r, g, b) on each and convert
+ * back, the destination chroma is the average of the two pixels.
+ */
+template <typename OP>
+static inline void csc_pair_rgb(const struct csc_ycbcr &in, const struct csc_ycbcr &out, csc_pair &p, OP op) {
+    float cb = ((float)p.cb - 512.0f) * in.inv_c_scale;
+    float cr = ((float)p.cr - 512.0f) * in.inv_c_scale;
+    float lm[2];
+    float ocb = 0.0f;
+    float ocr = 0.0f;
+    lm[0]     = ((float)p.y0 - in.y_offset) * in.inv_y_scale;
+    lm[1]     = ((float)p.y1 - in.y_offset) * in.inv_y_scale;
+#pragma unroll
+    for (int i = 0; i < 2; i++) {
+        float r = lm[i] + in.cr_r * cr;
+        float g = lm[i] + in.cb_g * cb + in.cr_g * cr;
+        float b = lm[i] + in.cb_b * cb;
+        op(r, g, b);
+        lm[i] = out.kr * r + out.kg * g + out.kb * b;
+        ocb += (b - lm[i]) * out.cb_scale;
+        ocr += (r - lm[i]) * out.cr_scale;
+    }
+    p.y0 = csc_ycbcr_quantize(out, lm[0], out.y_scale, out.y_offset);
+    p.y1 = csc_ycbcr_quantize(out, lm[1], out.y_scale, out.y_offset);
+    p.cb = csc_ycbcr_quantize(out, ocb * 0.5f, out.c_scale, 512.0f);
+    p.cr = csc_ycbcr_quantize(out, ocr * 0.5f, out.c_scale, 512.0f);
+}
+
+/**
+ * Apply colorimetry conversion to one pixel pair.
+ */
+static inline void csc_color_pair(const struct csc_color_params &c, csc_pair &p) {
+    csc_pair_rgb(c.in, c.out, p, [&](float &r, float &g, float &b) {
+        if (!c.skip_linear)
+            csc_color_rgb(c, r, g, b);
+    });
+}
+
+/**
+ * Fill Y'CbCr quantization and luma coefficients.
+ *
+ * @param q
+ *   The csc_ycbcr to be filled.
+ * @param primaries
+ *   Colour primaries selecting the luma coefficients, unspecified means BT.709.
+ * @param range
+ *   Quantization range, unspecified means limited.
+ */
+void impl_csc_ycbcr_init(struct csc_ycbcr *q, impl_color_primaries primaries, impl_color_range range);
+
+/**
+ * IMPL CSC colorimetry conversion initialize.
+ *
+ * Resolves unspecified colorimetry, builds the matrices and transfer LUTs and
+ * uploads the LUTs to device memory. pcolor->enable stays 0 when source and
+ * destination colorimetry are identical.
+ *
+ * @param pcsc
+ *   The impl_csc_params pointer.
+ * @param pcolor
+ *   The colorimetry parameters to be filled.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid colorimetry.
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_STATUS impl_csc_color_init(struct impl_csc_params *pcsc, struct csc_color_params *pcolor);
+
+/**
+ * IMPL CSC colorimetry conversion free.
+ *
+ * @param pq
+ *   The queue pointer the LUTs were allocated on.
+ * @param pcolor
+ *   The colorimetry parameters to be released.
+ */
+void impl_csc_color_uninit(void *pq, struct csc_color_params *pcolor);
+
+#endif
@@ -0,0 +1,310 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_CSC_PIXEL_HPP__
+#define __IMPL_CSC_PIXEL_HPP__
+
+#include "impl_common.hpp"
+
+/**
+ * Format-generic pixel access used by the generic CSC kernels.
+ *
+ * Every format is unpacked to / packed from horizontal 4:2:2 pixel pairs in 10 bit precision.
+ * 8 bit formats are scaled by 4 on load and truncated on store, 4:2:0 formats load the chroma
+ * of the row pair and store chroma from the even row only, same as the dedicated CSC kernels.
+ * All coordinates are in luma pixels, chroma accessors take chroma plane coordinates.
+ */
+struct csc_pair {
+    /** left luma */
+    unsigned short y0;
+    /** right luma */
+    unsigned short y1;
+    /** shared Cb */
+    unsigned short cb;
+    /** shared Cr */
+    unsigned short cr;
+};
+
+template <impl_video_format FORMAT> struct csc_pixel;
+
+/* Planar and semi-planar layouts, a stored sample T is converted to 10 bit by (sample >> DOWN) << UP */
+template <typename T, int UP, int DOWN, bool IS_420, bool IS_SEMI> struct csc_pixel_planar {
+    static constexpr int group_width    = 2;
+    static constexpr int chroma_shift_y = IS_420 ? 1 : 0;
+
+    static inline unsigned short load(const unsigned char *buf, size_t offset) {
+        return (unsigned short)((((const T *)buf)[offset] >> DOWN) << UP) & 0x3ff;
+    }
+    static inline void store(unsigned char *buf, size_t offset, unsigned short value) {
+        ((T *)buf)[offset] = (T)(((unsigned int)value >> UP) << DOWN);
+    }
+    static inline size_t cb_offset(uint32_t width, uint32_t height, uint32_t cx, uint32_t cy) {
+        if constexpr (IS_SEMI)
+            return (size_t)width * height + (size_t)cy * width + cx * 2;
+        else
+            return (size_t)width * height + (size_t)cy * (width / 2) + cx;
+    }
+    static inline size_t cr_offset(uint32_t width, uint32_t height, uint32_t cx, uint32_t cy) {
+        if constexpr (IS_SEMI)
+            return cb_offset(width, height, cx, cy) + 1;
+        else
+            return cb_offset(width, height, cx, cy) + (size_t)(width / 2) * (height >> chroma_shift_y);
+    }
+
+    static inline unsigned short read_lm(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x,
+                                         uint32_t y) {
+        return load(buf, (size_t)y * width + x);
+    }
+    static inline unsigned short read_cb(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        return load(buf, cb_offset(width, height, cx, cy));
+    }
+    static inline unsigned short read_cr(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        return load(buf, cr_offset(width, height, cx, cy));
+    }
+    static inline void read_pair(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                 csc_pair &p) {
+        p.y0 = read_lm(buf, width, height, x, y);
+        p.y1 = read_lm(buf, width, height, x + 1, y);
+        p.cb = read_cb(buf, width, height, x / 2, y >> chroma_shift_y);
+        p.cr = read_cr(buf, width, height, x / 2, y >> chroma_shift_y);
+    }
+    static inline void write_pair(unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                  const csc_pair &p) {
+        store(buf, (size_t)y * width + x, p.y0);
+        store(buf, (size_t)y * width + x + 1, p.y1);
+        if (IS_420 && (y & 1))
+            return;
+        store(buf, cb_offset(width, height, x / 2, y >> chroma_shift_y), p.cb);
+        store(buf, cr_offset(width, height, x / 2, y >> chroma_shift_y), p.cr);
+    }
+    template <int PAIRS>
+    static inline void write_group(unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                   const csc_pair *p) {
+#pragma unroll
+        for (int i = 0; i < PAIRS; i++)
+            write_pair(buf, width, height, x + i * 2, y, p[i]);
+    }
+};
+
+template <>
+struct csc_pixel<IMPL_VIDEO_I420> : csc_pixel_planar<unsigned char, 2, 0, true, false> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_NV12> : csc_pixel_planar<unsigned char, 2, 0, true, true> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_P010> : csc_pixel_planar<unsigned short, 0, 6, true, true> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_YUV420P10LE> : csc_pixel_planar<unsigned short, 0, 0, true, false> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_YUV422P10LE> : csc_pixel_planar<unsigned short, 0, 0, false, false> {};
+
+/* Packed 4:2:2 layouts addressed per pixel pair */
+template <typename PACK> struct csc_pixel_packed422 {
+    static constexpr int group_width    = 2;
+    static constexpr int chroma_shift_y = 0;
+
+    static inline unsigned short read_lm(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x,
+                                         uint32_t y) {
+        csc_pair p;
+        PACK::unpack(buf, width, x / 2, y, p);
+        return (x & 1) ? p.y1 : p.y0;
+    }
+    static inline unsigned short read_cb(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        csc_pair p;
+        PACK::unpack(buf, width, cx, cy, p);
+        return p.cb;
+    }
+    static inline unsigned short read_cr(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        csc_pair p;
+        PACK::unpack(buf, width, cx, cy, p);
+        return p.cr;
+    }
+    static inline void read_pair(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                 csc_pair &p) {
+        PACK::unpack(buf, width, x / 2, y, p);
+    }
+    static inline void write_pair(unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                  const csc_pair &p) {
+        PACK::pack(buf, width, x / 2, y, p);
+    }
+    template <int PAIRS>
+    static inline void write_group(unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                   const csc_pair *p) {
+#pragma unroll
+        for (int i = 0; i < PAIRS; i++)
+            PACK::pack(buf, width, x / 2 + i, y, p[i]);
+    }
+};
+
+/* Y210: 16 bit Y0 Cb Y1 Cr, 10 bit MSB aligned */
+struct csc_pack_y210 {
+    static inline void unpack(const unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, csc_pair &p) {
+        const unsigned short *src = (const unsigned short *)buf + (size_t)y * width * 2 + pair * 4;
+        p.y0                      = src[0] >> 6;
+        p.cb                      = src[1] >> 6;
+        p.y1                      = src[2] >> 6;
+        p.cr                      = src[3] >> 6;
+    }
+    static inline void pack(unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, const csc_pair &p) {
+        unsigned short *dst = (unsigned short *)buf + (size_t)y * width * 2 + pair * 4;
+        dst[0]              = p.y0 << 6;
+        dst[1]              = p.cb << 6;
+        dst[2]              = p.y1 << 6;
+        dst[3]              = p.cr << 6;
+    }
+};
+
+/* yuv422ycbcr10be: ST 2110-20 pgroup, 5 bytes big endian Cb Y0 Cr Y1 */
+struct csc_pack_ycbcr10be {
+    static inline void unpack_pgroup(const unsigned char *src, csc_pair &p) {
+        p.cb = ((unsigned short)src[0] << 2) | (src[1] >> 6);
+        p.y0 = (((unsigned short)src[1] & 0x3f) << 4) | (src[2] >> 4);
+        p.cr = (((unsigned short)src[2] & 0x0f) << 6) | (src[3] >> 2);
+        p.y1 = (((unsigned short)src[3] & 0x03) << 8) | src[4];
+    }
+    static inline void pack_pgroup(unsigned char *dst, const csc_pair &p) {
+        dst[0] = p.cb >> 2;
+        dst[1] = ((p.cb & 0x03) << 6) | (p.y0 >> 4);
+        dst[2] = ((p.y0 & 0x0f) << 4) | (p.cr >> 6);
+        dst[3] = ((p.cr & 0x3f) << 2) | (p.y1 >> 8);
+        dst[4] = p.y1 & 0xff;
+    }
+    static inline void unpack(const unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, csc_pair &p) {
+        unpack_pgroup(buf + (size_t)y * (width * 5 / 2) + pair * 5, p);
+    }
+    static inline void pack(unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, const csc_pair &p) {
+        pack_pgroup(buf + (size_t)y * (width * 5 / 2) + pair * 5, p);
+    }
+};
+
+/* yuv422ycbcr10le: 5 bytes little endian Cb | Y0 << 10 | Cr << 20 | Y1 << 30 */
+struct csc_pack_ycbcr10le {
+    static inline void unpack(const unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, csc_pair &p) {
+        const unsigned char *src = buf + (size_t)y * (width * 5 / 2) + pair * 5;
+        unsigned long t = (unsigned long)src[0] | ((unsigned long)src[1] << 8) | ((unsigned long)src[2] << 16) |
+                          ((unsigned long)src[3] << 24) | ((unsigned long)src[4] << 32);
+        p.cb = t & 0x3ff;
+        p.y0 = (t >> 10) & 0x3ff;
+        p.cr = (t >> 20) & 0x3ff;
+        p.y1 = (t >> 30) & 0x3ff;
+    }
+    static inline void pack(unsigned char *buf, uint32_t width, uint32_t pair, uint32_t y, const csc_pair &p) {
+        unsigned char *dst = buf + (size_t)y * (width * 5 / 2) + pair * 5;
+        unsigned long t    = (unsigned long)p.cb | ((unsigned long)p.y0 << 10) | ((unsigned long)p.cr << 20) |
+                          ((unsigned long)p.y1 << 30);
+        dst[0] = t & 0xff;
+        dst[1] = (t >> 8) & 0xff;
+        dst[2] = (t >> 16) & 0xff;
+        dst[3] = (t >> 24) & 0xff;
+        dst[4] = (t >> 32) & 0xff;
+    }
+};
+
+template <>
+struct csc_pixel<IMPL_VIDEO_Y210> : csc_pixel_packed422<csc_pack_y210> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_YUV422YCBCR10BE> : csc_pixel_packed422<csc_pack_ycbcr10be> {};
+template <>
+struct csc_pixel<IMPL_VIDEO_YUV422YCBCR10LE> : csc_pixel_packed422<csc_pack_ycbcr10le> {};
+
+/* V210: 4 dwords per 6 pixels, stored and written as whole groups */
+template <>
+struct csc_pixel<IMPL_VIDEO_V210> {
+    static constexpr int group_width    = 6;
+    static constexpr int chroma_shift_y = 0;
+
+    static inline const unsigned int *group(const unsigned char *buf, uint32_t width, uint32_t x, uint32_t y) {
+        return (const unsigned int *)buf + (size_t)y * (width * 2 / 3) + x / 6 * 4;
+    }
+    static inline unsigned short read_lm(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x,
+                                         uint32_t y) {
+        const int idx_tab[6]   = {0, 1, 1, 2, 3, 3};
+        const int shift_tab[6] = {10, 0, 20, 10, 0, 20};
+        return (group(buf, width, x, y)[idx_tab[x % 6]] >> shift_tab[x % 6]) & 0x3ff;
+    }
+    static inline unsigned short read_cb(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        const int idx_tab[3]   = {0, 1, 2};
+        const int shift_tab[3] = {0, 10, 20};
+        return (group(buf, width, cx * 2, cy)[idx_tab[cx % 3]] >> shift_tab[cx % 3]) & 0x3ff;
+    }
+    static inline unsigned short read_cr(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t cx,
+                                         uint32_t cy) {
+        const int idx_tab[3]   = {0, 2, 3};
+        const int shift_tab[3] = {20, 0, 10};
+        return (group(buf, width, cx * 2, cy)[idx_tab[cx % 3]] >> shift_tab[cx % 3]) & 0x3ff;
+    }
+    static inline void read_pair(const unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                 csc_pair &p) {
+        p.y0 = read_lm(buf, width, height, x, y);
+        p.y1 = read_lm(buf, width, height, x + 1, y);
+        p.cb = read_cb(buf, width, height, x / 2, y);
+        p.cr = read_cr(buf, width, height, x / 2, y);
+    }
+    template <int PAIRS>
+    static inline void write_group(unsigned char *buf, uint32_t width, uint32_t height, uint32_t x, uint32_t y,
+                                   const csc_pair *p) {
+        static_assert(PAIRS == 3, "v210 is written in groups of 6 pixels");
+        unsigned int *dst = (unsigned int *)group(buf, width, x, y);
+        dst[0]            = p[0].cb | (p[0].y0 << 10) | (p[0].cr << 20);
+        dst[1]            = p[0].y1 | (p[1].cb << 10) | (p[1].y0 << 20);
+        dst[2]            = p[1].cr | (p[1].y1 << 10) | (p[2].cb << 20);
+        dst[3]            = p[2].y0 | (p[2].cr << 10) | (p[2].y1 << 20);
+    }
+};
+
+/**
+ * Pack a group of PAIRS pixel pairs to a format chosen at run time, used when one
+ * kernel writes several output formats. V210 needs groups of 3 pairs.
+ */
+template <int PAIRS>
+static inline void csc_write_group_any(impl_video_format format, unsigned char *buf, uint32_t width, uint32_t height,
+                                       uint32_t x, uint32_t y, const csc_pair *p) {
+    switch (format) {
+    case IMPL_VIDEO_I420:
+        csc_pixel<IMPL_VIDEO_I420>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_V210:
+        if constexpr (PAIRS == 3)
+            csc_pixel<IMPL_VIDEO_V210>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_Y210:
+        csc_pixel<IMPL_VIDEO_Y210>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_NV12:
+        csc_pixel<IMPL_VIDEO_NV12>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_P010:
+        csc_pixel<IMPL_VIDEO_P010>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_YUV420P10LE:
+        csc_pixel<IMPL_VIDEO_YUV420P10LE>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_YUV422P10LE:
+        csc_pixel<IMPL_VIDEO_YUV422P10LE>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_YUV422YCBCR10BE:
+        csc_pixel<IMPL_VIDEO_YUV422YCBCR10BE>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    case IMPL_VIDEO_YUV422YCBCR10LE:
+        csc_pixel<IMPL_VIDEO_YUV422YCBCR10LE>::template write_group<PAIRS>(buf, width, height, x, y, p);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Pixels processed by one work item when converting between two formats.
+ */
+template <impl_video_format IN_FORMAT, impl_video_format OUT_FORMAT> constexpr int csc_group_width() {
+    return csc_pixel<IN_FORMAT>::group_width > csc_pixel<OUT_FORMAT>::group_width
+               ? csc_pixel<IN_FORMAT>::group_width
+               : csc_pixel<OUT_FORMAT>::group_width;
+}
+
+#endif
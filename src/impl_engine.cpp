@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_engine.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "impl_api.h"
+#include "impl_common.hpp"
+#include "impl_trace.hpp"
+
+/* never with discard_events, impl_engine_end_frame retires frames by the events of their runs */
+static queue *engine_new_queue(const context &ctx, const device &dev, struct impl_engine_params *pen) {
+    if (pen->enable_profiling && pen->in_order)
+        return new queue(ctx, dev, property_list{property::queue::enable_profiling(), property::queue::in_order()});
+    if (pen->enable_profiling)
+        return new queue(ctx, dev, property_list{property::queue::enable_profiling()});
+    if (pen->in_order)
+        return new queue(ctx, dev, property_list{property::queue::in_order()});
+    return new queue(ctx, dev);
+}
+
+IMPL_STATUS impl_engine_init(struct impl_engine_params *pen, void *&pen_context) {
+    IMPL_ASSERT(pen != NULL, "engine init failed, pen is null");
+    if (pen->num_queues < 1 || pen->num_queues > IMPL_ENGINE_MAX_QUEUES) {
+        err("%s, Illegal number of queues %d, must be 1 .. %d\n", __func__, pen->num_queues,
+            IMPL_ENGINE_MAX_QUEUES);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pen->policy < IMPL_ENGINE_ROUND_ROBIN || pen->policy >= IMPL_ENGINE_POLICY_MAX) {
+        err("%s, Illegal policy %d\n", __func__, pen->policy);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pen->max_in_flight < 0 || pen->backpressure < IMPL_ENGINE_BLOCK ||
+        pen->backpressure >= IMPL_ENGINE_BACKPRESSURE_MAX) {
+        err("%s, Illegal backpressure %d with max_in_flight %d\n", __func__, pen->backpressure,
+            pen->max_in_flight);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    impl_engine_context *pcontext = new impl_engine_context();
+    pcontext->policy              = pen->policy;
+    pcontext->num_queues          = pen->num_queues;
+    pcontext->max_in_flight       = pen->max_in_flight;
+    pcontext->backpressure        = pen->backpressure;
+    try {
+        device dev;
+        if (pen->is_target_cpu) {
+#ifdef ONLY_FOR_GPU
+            err("%s, The current library is compiled on the GPU using AOT\n", __func__);
+            delete pcontext;
+            return IMPL_STATUS_FAIL;
+#else
+            dev = device(cpu_selector_v);
+#endif
+        } else {
+            dev = device(gpu_selector_v);
+        }
+        // one context for all queues, so USM from any of them is valid on every queue
+        context ctx(dev);
+        for (int i = 0; i < pen->num_queues; i++)
+            pcontext->queues[i] = engine_new_queue(ctx, dev, pen);
+        if (pen->transfer_queue)
+            pcontext->transfer = engine_new_queue(ctx, dev, pen);
+        info("%s, Selected device: %s, %d compute queues%s\n", __func__,
+             dev.get_info<info::device::name>().c_str(), pen->num_queues,
+             pen->transfer_queue ? " and a transfer queue" : "");
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        impl_engine_uninit(pcontext);
+        return IMPL_STATUS_FAIL;
+    }
+
+    pen_context = (void *)pcontext;
+    return IMPL_STATUS_SUCCESS;
+}
+
+void *impl_engine_get_queue(void *pen_context, int *queue_index) {
+    IMPL_ASSERT(pen_context != NULL, "engine get queue failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    std::lock_guard<std::mutex> guard(pcontext->lock);
+
+    int index = 0;
+    if (IMPL_ENGINE_LEAST_LOADED == pcontext->policy) {
+        for (int i = 1; i < pcontext->num_queues; i++)
+            if (pcontext->streams[i] < pcontext->streams[index])
+                index = i;
+    } else {
+        index          = pcontext->next;
+        pcontext->next = (index + 1) % pcontext->num_queues;
+    }
+    pcontext->streams[index]++;
+    if (queue_index != NULL)
+        *queue_index = index;
+    return (void *)pcontext->queues[index];
+}
+
+void impl_engine_release_queue(void *pen_context, int queue_index) {
+    IMPL_ASSERT(pen_context != NULL, "engine release queue failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    if (queue_index < 0 || queue_index >= pcontext->num_queues) {
+        err("%s, Illegal queue index %d\n", __func__, queue_index);
+        return;
+    }
+    std::lock_guard<std::mutex> guard(pcontext->lock);
+    if (pcontext->streams[queue_index] > 0)
+        pcontext->streams[queue_index]--;
+}
+
+/* drops the completed frames of a compute queue, called with the lock held */
+static void engine_retire(impl_engine_context *pcontext, int queue_index) {
+    std::deque<event> &frames = pcontext->frames[queue_index];
+    for (auto it = frames.begin(); it != frames.end();) {
+        if (it->get_info<info::event::command_execution_status>() == info::event_command_status::complete)
+            it = frames.erase(it);
+        else
+            ++it;
+    }
+}
+
+IMPL_STATUS impl_engine_begin_frame(void *pen_context, int queue_index) {
+    IMPL_ASSERT(pen_context != NULL, "engine begin frame failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    if (queue_index < 0 || queue_index >= pcontext->num_queues) {
+        err("%s, Illegal queue index %d\n", __func__, queue_index);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    std::unique_lock<std::mutex> guard(pcontext->lock);
+    std::deque<event> &frames    = pcontext->frames[queue_index];
+    struct impl_engine_stats &st = pcontext->stats[queue_index];
+    if (pcontext->max_in_flight > 0) {
+        engine_retire(pcontext, queue_index);
+        bool waited = false;
+        while ((int)frames.size() + pcontext->open[queue_index] >= pcontext->max_in_flight) {
+            if (IMPL_ENGINE_FAIL_FAST == pcontext->backpressure) {
+                st.rejected++;
+                return IMPL_STATUS_BUSY;
+            }
+            waited = true;
+            if (frames.empty()) {
+                // every slot is a frame still being submitted, wait for one to be closed
+                pcontext->closed.wait(guard);
+            } else {
+                event oldest = frames.front();
+                guard.unlock();
+                oldest.wait();
+                guard.lock();
+            }
+            engine_retire(pcontext, queue_index);
+        }
+        if (waited)
+            st.blocked++;
+    }
+    pcontext->open[queue_index]++;
+    st.admitted++;
+    return IMPL_STATUS_SUCCESS;
+}
+
+void impl_engine_end_frame(void *pen_context, int queue_index, void *evt) {
+    IMPL_ASSERT(pen_context != NULL, "engine end frame failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    if (queue_index < 0 || queue_index >= pcontext->num_queues) {
+        err("%s, Illegal queue index %d\n", __func__, queue_index);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(pcontext->lock);
+        if (pcontext->open[queue_index] > 0)
+            pcontext->open[queue_index]--;
+        // also without max_in_flight, so the queue only holds the events of frames still running
+        engine_retire(pcontext, queue_index);
+        if (evt != NULL)
+            pcontext->frames[queue_index].push_back(*(event *)evt);
+    }
+    pcontext->closed.notify_all();
+}
+
+void impl_engine_get_stats(void *pen_context, int queue_index, struct impl_engine_stats *pstats) {
+    IMPL_ASSERT(pen_context != NULL, "engine get stats failed, pen_context is null");
+    IMPL_ASSERT(pstats != NULL, "engine get stats failed, pstats is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    if (queue_index < 0 || queue_index >= pcontext->num_queues) {
+        err("%s, Illegal queue index %d\n", __func__, queue_index);
+        return;
+    }
+    std::lock_guard<std::mutex> guard(pcontext->lock);
+    engine_retire(pcontext, queue_index);
+    *pstats           = pcontext->stats[queue_index];
+    pstats->in_flight = (int)pcontext->frames[queue_index].size() + pcontext->open[queue_index];
+}
+
+void *impl_engine_transfer_queue(void *pen_context) {
+    IMPL_ASSERT(pen_context != NULL, "engine transfer queue failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    return (void *)(pcontext->transfer ? pcontext->transfer : pcontext->queues[0]);
+}
+
+void impl_engine_sync(void *pen_context) {
+    IMPL_ASSERT(pen_context != NULL, "engine sync failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    for (int i = 0; i < pcontext->num_queues; i++)
+        pcontext->queues[i]->wait();
+    if (pcontext->transfer)
+        pcontext->transfer->wait();
+}
+
+void impl_engine_uninit(void *pen_context) {
+    IMPL_ASSERT(pen_context != NULL, "engine uninit failed, pen_context is null");
+    impl_engine_context *pcontext = (impl_engine_context *)pen_context;
+    if (pcontext->queues[0] != NULL)
+        impl_common_drop_callback_queue(pcontext->queues[0]->get_context());
+    for (int i = 0; i < pcontext->num_queues; i++)
+        delete pcontext->queues[i];
+    delete pcontext->transfer;
+    delete pcontext;
+}
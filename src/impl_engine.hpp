@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_ENGINE_HPP__
+#define __IMPL_ENGINE_HPP__
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "impl_common.hpp"
+
+struct impl_engine_context {
+    /** stream to compute queue assignment */
+    impl_engine_policy policy;
+    /** number of compute queues */
+    int num_queues;
+    /** compute queues, all on one context */
+    queue *queues[IMPL_ENGINE_MAX_QUEUES];
+    /** streams served by each compute queue */
+    int streams[IMPL_ENGINE_MAX_QUEUES];
+    /** next compute queue of IMPL_ENGINE_ROUND_ROBIN */
+    int next;
+    /** transfer queue, NULL if not created */
+    queue *transfer;
+    /** frames in flight per compute queue before backpressure applies, 0 is unbounded */
+    int max_in_flight;
+    /** action when a compute queue is full */
+    impl_engine_backpressure backpressure;
+    /** last events of the closed frames per compute queue, oldest first, completed ones are dropped lazily */
+    std::deque<event> frames[IMPL_ENGINE_MAX_QUEUES];
+    /** frames admitted and not closed yet per compute queue */
+    int open[IMPL_ENGINE_MAX_QUEUES];
+    /** queue depth counters, in_flight is computed on request */
+    struct impl_engine_stats stats[IMPL_ENGINE_MAX_QUEUES];
+    /** guards everything above */
+    std::mutex lock;
+    /** signalled when a frame is closed */
+    std::condition_variable closed;
+};
+
+#endif
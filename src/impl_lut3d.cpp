@@ -0,0 +1,208 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_lut3d.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "impl_api.h"
+#include "impl_trace.hpp"
+
+/* Intel 3D LUT layouts: lattice points per axis and padded size of the fastest axis */
+static const int lut3d_layouts[][2] = {{17, 32}, {33, 64}, {65, 128}};
+
+template <impl_video_format FORMAT>
+IMPL_STATUS impl_lut3d_kernel(struct impl_lut3d_params *plut, impl_lut3d_context *pcontext, unsigned char *buf_in,
+                              unsigned char *buf_out, void *dep_evt) {
+    IMPL_ASSERT(plut->pq != NULL, "pq is null");
+    IMPL_ASSERT(buf_in != NULL, "buf_in is null");
+    IMPL_ASSERT(buf_out != NULL, "buf_out is null");
+    constexpr int group_width          = csc_pixel<FORMAT>::group_width;
+    queue q                            = *(queue *)(plut->pq);
+    uint32_t width                     = plut->width;
+    uint32_t height                    = plut->height;
+    struct lut3d_kernel_params kparams = pcontext->kparams;
+    IMPL_STATUS ret                    = IMPL_STATUS_SUCCESS;
+    auto event                         = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            h.parallel_for(sycl::range<2>(height, width / group_width), [=](sycl::id<2> idx) {
+                const uint32_t y = idx[0];
+                const uint32_t x = idx[1] * group_width;
+                csc_pair pairs[group_width / 2];
+#pragma unroll
+                for (int i = 0; i < group_width / 2; i++) {
+                    csc_pixel<FORMAT>::read_pair(buf_in, width, height, x + i * 2, y, pairs[i]);
+                    lut3d_apply_pair(kparams, pairs[i]);
+                }
+                csc_pixel<FORMAT>::template write_group<group_width / 2>(buf_out, width, height, x, y, pairs);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, plut->evt, event, plut->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*LUT3D_function)(struct impl_lut3d_params *plut, impl_lut3d_context *pcontext,
+                                      unsigned char *buf_in, unsigned char *buf_out, void *dep_evt);
+
+constexpr LUT3D_function lut3dfunction[IMPL_VIDEO_MAX] = {impl_lut3d_kernel<IMPL_VIDEO_I420>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_V210>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_Y210>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_NV12>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_P010>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_YUV420P10LE>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_YUV422P10LE>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                          impl_lut3d_kernel<IMPL_VIDEO_YUV422YCBCR10LE>};
+
+static size_t lut3d_bytes(int size, int mul) {
+    return (size_t)size * size * mul * 4 * sizeof(unsigned short);
+}
+
+/* load the cube from file or host memory, the cube size is taken from the file size */
+static IMPL_STATUS lut3d_load(struct impl_lut3d_params *plut, std::vector<unsigned short> &data, int &size,
+                              int &mul) {
+    size_t bytes = 0;
+    FILE *fp     = NULL;
+    if (plut->lut_file != NULL) {
+        fp = fopen(plut->lut_file, "rb");
+        if (fp == NULL) {
+            err("%s, open 3dlut file %s failed\n", __func__, plut->lut_file);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+        fseek(fp, 0L, SEEK_END);
+        bytes = ftell(fp);
+        rewind(fp);
+    }
+
+    size = 0;
+    for (auto &layout : lut3d_layouts) {
+        if ((fp != NULL && bytes == lut3d_bytes(layout[0], layout[1])) ||
+            (fp == NULL && plut->lut_size == layout[0])) {
+            size = layout[0];
+            mul  = layout[1];
+        }
+    }
+    if (size == 0) {
+        err("%s, unsupported 3dlut size, only 17/33/65 point Intel layouts are supported\n", __func__);
+        if (fp != NULL)
+            fclose(fp);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    bytes = lut3d_bytes(size, mul);
+    data.resize(bytes / sizeof(unsigned short));
+    if (fp != NULL) {
+        size_t readsize = fread(data.data(), 1, bytes, fp);
+        fclose(fp);
+        if (readsize != bytes) {
+            err("%s, read 3dlut file %s failed\n", __func__, plut->lut_file);
+            return IMPL_STATUS_FAIL;
+        }
+    } else {
+        memcpy(data.data(), plut->lut_data, bytes);
+    }
+    return IMPL_STATUS_SUCCESS;
+}
+
+IMPL_STATUS impl_lut3d_init(struct impl_lut3d_params *plut, void *&plut_context) {
+    IMPL_ASSERT(plut != NULL, "lut3d init failed, plut is null");
+    IMPL_ASSERT(plut->pq != NULL, "lut3d init failed, pq is null");
+    if (plut->format < 0 || plut->format >= IMPL_VIDEO_MAX) {
+        err("%s, unsupported format %d\n", __func__, plut->format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (plut->interp < 0 || plut->interp >= IMPL_LUT3D_INTERP_MAX || plut->mapping < 0 ||
+        plut->mapping >= IMPL_LUT3D_MAPPING_MAX) {
+        err("%s, invalid interp %d or mapping %d\n", __func__, plut->interp, plut->mapping);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (plut->lut_file == NULL && plut->lut_data == NULL) {
+        err("%s, neither lut_file nor lut_data is set\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((plut->width % 2) != 0 || (plut->height % 2) != 0) {
+        err("%s, Illegal size: The width and height must be a multiple of 2\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (IMPL_VIDEO_V210 == plut->format && (plut->width % 48) != 0) {
+        err("%s, Illegal V210 size: The width must be a multiple of 48\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    std::vector<unsigned short> data;
+    int size, mul;
+    IMPL_STATUS ret = lut3d_load(plut, data, size, mul);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+
+    queue q                      = *(queue *)(plut->pq);
+    impl_lut3d_context *pcontext = new impl_lut3d_context;
+    memset(pcontext, 0, sizeof(impl_lut3d_context));
+    struct lut3d_kernel_params &kparams = pcontext->kparams;
+    kparams.interp                      = plut->interp;
+    kparams.mapping                     = plut->mapping;
+    kparams.size                        = size;
+    kparams.mul                         = mul;
+    impl_csc_ycbcr_init(&kparams.ycbcr, plut->color.primaries, plut->color.range);
+    try {
+        kparams.lut = sycl::malloc_device<unsigned short>(data.size(), q);
+        if (kparams.lut == NULL) {
+            err("%s, 3dlut allocation failed\n", __func__);
+            delete pcontext;
+            return IMPL_STATUS_FAIL;
+        }
+        q.memcpy(kparams.lut, data.data(), data.size() * sizeof(unsigned short)).wait();
+    } catch (std::exception e) {
+        err("%s, SYCL exception caught: %s\n", __func__, e.what());
+        if (kparams.lut != NULL)
+            sycl::free(kparams.lut, q);
+        delete pcontext;
+        return IMPL_STATUS_FAIL;
+    }
+    kparams.enable = 1;
+    plut->evt      = impl_common_new_event();
+    plut_context   = (void *)pcontext;
+    dbg("%s, %d point 3dlut loaded, interp %d mapping %d\n", __func__, size, plut->interp, plut->mapping);
+    return IMPL_STATUS_SUCCESS;
+}
+
+IMPL_STATUS impl_lut3d_run(struct impl_lut3d_params *plut, void *plut_context, unsigned char *buf_in,
+                           unsigned char *buf_out, void *dep_evt) {
+    IMPL_ASSERT(plut != NULL, "lut3d run failed, plut is null");
+    IMPL_ASSERT(plut_context != NULL, "lut3d run failed, plut_context is null");
+    struct impl_lut3d_context *pcontext = (struct impl_lut3d_context *)plut_context;
+    IMPL_STATUS ret = lut3dfunction[plut->format](plut, pcontext, buf_in, buf_out, dep_evt);
+    IMPL_ASSERT(ret >= 0, "lut3d function failed");
+    return ret;
+}
+
+IMPL_STATUS impl_lut3d_run_evt(struct impl_lut3d_params *plut, void *plut_context, unsigned char *buf_in,
+                               unsigned char *buf_out, void *dep_evt, void *&evt) {
+    IMPL_ASSERT(plut != NULL, "lut3d run failed, plut is null");
+    return impl_common_run_evt(plut, evt, impl_lut3d_run, plut_context, buf_in, buf_out, dep_evt);
+}
+
+IMPL_STATUS impl_lut3d_uninit(struct impl_lut3d_params *plut, void *plut_context) {
+    IMPL_ASSERT(plut != NULL, "lut3d uninit failed, plut is null");
+    IMPL_ASSERT(plut_context != NULL, "lut3d uninit failed, plut_context is null");
+    struct impl_lut3d_context *pcontext = (struct impl_lut3d_context *)plut_context;
+    queue q                             = *(queue *)(plut->pq);
+    sycl::free(pcontext->kparams.lut, q);
+    impl_common_free_event(plut->evt);
+    delete pcontext;
+    return IMPL_STATUS_SUCCESS;
+}
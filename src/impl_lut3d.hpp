@@ -0,0 +1,147 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_LUT3D_HPP__
+#define __IMPL_LUT3D_HPP__
+
+#include "impl_common.hpp"
+#include "impl_csc_color.hpp"
+#include "impl_csc_pixel.hpp"
+
+/**
+ * Device side 3D LUT parameters, passed by value into the kernels.
+ *
+ * The cube uses the Intel 17/33/65 point layout of the VA 3D LUT samples: lattice
+ * point (r, g, b) is stored at ((r * size + g) * mul + b) as 4 unsigned shorts R, G, B, A
+ * with full scale 65535, mul is the axis size padded to 32, 64 or 128.
+ */
+struct lut3d_kernel_params {
+    /** 3D LUT enabled */
+    int enable;
+    /** impl_lut3d_interp */
+    int interp;
+    /** impl_lut3d_mapping */
+    int mapping;
+    /** lattice points per axis */
+    int size;
+    /** padded size of the fastest axis */
+    int mul;
+    /** Y'CbCr quantization for IMPL_LUT3D_MAPPING_RGB */
+    struct csc_ycbcr ycbcr;
+    /** device cube data */
+    unsigned short *lut;
+};
+
+struct impl_lut3d_context {
+    /** device side parameters, also copied into fused CSC contexts */
+    struct lut3d_kernel_params kparams;
+};
+
+static inline void lut3d_fetch(const struct lut3d_kernel_params &l, int r, int g, int b, float c[3]) {
+    const unsigned short *e = l.lut + ((size_t)(r * l.size + g) * l.mul + b) * 4;
+    c[0]                    = (float)e[0];
+    c[1]                    = (float)e[1];
+    c[2]                    = (float)e[2];
+}
+
+/**
+ * Look up one normalized triple, inputs and outputs are in [0, 1].
+ */
+static inline void lut3d_lookup(const struct lut3d_kernel_params &l, float &x, float &y, float &z) {
+    const float scale = (float)(l.size - 1);
+    float px          = sycl::clamp(x, 0.0f, 1.0f) * scale;
+    float py          = sycl::clamp(y, 0.0f, 1.0f) * scale;
+    float pz          = sycl::clamp(z, 0.0f, 1.0f) * scale;
+    int r             = sycl::min((int)px, l.size - 2);
+    int g             = sycl::min((int)py, l.size - 2);
+    int b             = sycl::min((int)pz, l.size - 2);
+    float fr          = px - (float)r;
+    float fg          = py - (float)g;
+    float fb          = pz - (float)b;
+    float out[3]      = {0.0f, 0.0f, 0.0f};
+    float c000[3], c111[3], c1[3], c2[3];
+    lut3d_fetch(l, r, g, b, c000);
+    lut3d_fetch(l, r + 1, g + 1, b + 1, c111);
+
+    if (l.interp == IMPL_LUT3D_INTERP_TRILINEAR) {
+        float c001[3], c010[3], c011[3], c100[3], c101[3], c110[3];
+        lut3d_fetch(l, r, g, b + 1, c001);
+        lut3d_fetch(l, r, g + 1, b, c010);
+        lut3d_fetch(l, r, g + 1, b + 1, c011);
+        lut3d_fetch(l, r + 1, g, b, c100);
+        lut3d_fetch(l, r + 1, g, b + 1, c101);
+        lut3d_fetch(l, r + 1, g + 1, b, c110);
+#pragma unroll
+        for (int i = 0; i < 3; i++) {
+            float c00 = c000[i] + fb * (c001[i] - c000[i]);
+            float c01 = c010[i] + fb * (c011[i] - c010[i]);
+            float c10 = c100[i] + fb * (c101[i] - c100[i]);
+            float c11 = c110[i] + fb * (c111[i] - c110[i]);
+            float c0  = c00 + fg * (c01 - c00);
+            float c1  = c10 + fg * (c11 - c10);
+            out[i]    = c0 + fr * (c1 - c0);
+        }
+    } else {
+        // pick the tetrahedron containing the point and blend its 4 vertices
+        float w0, w1, w2, w3;
+        if (fr > fg) {
+            if (fg > fb) {
+                lut3d_fetch(l, r + 1, g, b, c1);
+                lut3d_fetch(l, r + 1, g + 1, b, c2);
+                w0 = 1.0f - fr, w1 = fr - fg, w2 = fg - fb, w3 = fb;
+            } else if (fr > fb) {
+                lut3d_fetch(l, r + 1, g, b, c1);
+                lut3d_fetch(l, r + 1, g, b + 1, c2);
+                w0 = 1.0f - fr, w1 = fr - fb, w2 = fb - fg, w3 = fg;
+            } else {
+                lut3d_fetch(l, r, g, b + 1, c1);
+                lut3d_fetch(l, r + 1, g, b + 1, c2);
+                w0 = 1.0f - fb, w1 = fb - fr, w2 = fr - fg, w3 = fg;
+            }
+        } else {
+            if (fb > fg) {
+                lut3d_fetch(l, r, g, b + 1, c1);
+                lut3d_fetch(l, r, g + 1, b + 1, c2);
+                w0 = 1.0f - fb, w1 = fb - fg, w2 = fg - fr, w3 = fr;
+            } else if (fb > fr) {
+                lut3d_fetch(l, r, g + 1, b, c1);
+                lut3d_fetch(l, r, g + 1, b + 1, c2);
+                w0 = 1.0f - fg, w1 = fg - fb, w2 = fb - fr, w3 = fr;
+            } else {
+                lut3d_fetch(l, r, g + 1, b, c1);
+                lut3d_fetch(l, r + 1, g + 1, b, c2);
+                w0 = 1.0f - fg, w1 = fg - fr, w2 = fr - fb, w3 = fb;
+            }
+        }
+#pragma unroll
+        for (int i = 0; i < 3; i++)
+            out[i] = w0 * c000[i] + w1 * c1[i] + w2 * c2[i] + w3 * c111[i];
+    }
+    x = out[0] * (1.0f / 65535.0f);
+    y = out[1] * (1.0f / 65535.0f);
+    z = out[2] * (1.0f / 65535.0f);
+}
+
+/**
+ * Apply the 3D LUT to one pixel pair, chroma of the pair is the average of both results.
+ */
+static inline void lut3d_apply_pair(const struct lut3d_kernel_params &l, csc_pair &p) {
+    if (l.mapping == IMPL_LUT3D_MAPPING_RGB) {
+        csc_pair_rgb(l.ycbcr, l.ycbcr, p, [&](float &r, float &g, float &b) { lut3d_lookup(l, r, g, b); });
+        return;
+    }
+    float cb = (float)p.cb * (1.0f / 1023.0f);
+    float cr = (float)p.cr * (1.0f / 1023.0f);
+    float y0 = (float)p.y0 * (1.0f / 1023.0f);
+    float y1 = (float)p.y1 * (1.0f / 1023.0f);
+    float cb1 = cb, cr1 = cr;
+    lut3d_lookup(l, y0, cb, cr);
+    lut3d_lookup(l, y1, cb1, cr1);
+    p.y0 = (unsigned short)(y0 * 1023.0f + 0.5f);
+    p.y1 = (unsigned short)(y1 * 1023.0f + 0.5f);
+    p.cb = (unsigned short)((cb + cb1) * 511.5f + 0.5f);
+    p.cr = (unsigned short)((cr + cr1) * 511.5f + 0.5f);
+}
+
+#endif
@@ -68,10 +68,7 @@ IMPL_STATUS composition_i420(struct impl_mixer_params *pmixer, struct impl_mixer
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -114,10 +111,7 @@ IMPL_STATUS composition_v210(struct impl_mixer_params *pmixer, struct impl_mixer
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -199,10 +193,7 @@ IMPL_STATUS alphablending_alphasurf_i420(struct impl_mixer_params *pmixer, struc
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -280,10 +271,7 @@ IMPL_STATUS alphablending_staticalpha_i420(struct impl_mixer_params *pmixer, str
             ret = IMPL_STATUS_FAIL;
         }
     });
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -390,10 +378,7 @@ IMPL_STATUS alphablending_alphasurf_v210(struct impl_mixer_params *pmixer, struc
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -494,10 +479,7 @@ IMPL_STATUS alphablending_staticalpha_v210(struct impl_mixer_params *pmixer, str
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -580,10 +562,7 @@ IMPL_STATUS alphablending_alphasurf_yuv420p10le(struct impl_mixer_params *pmixer
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -663,10 +642,7 @@ IMPL_STATUS alphablending_staticalpha_yuv420p10le(struct impl_mixer_params *pmix
         }
     });
 
-    if (pmixer->is_async == 0) {
-        event.wait();
-    }
-    *(sycl::event *)pfield->evt = event;
+    impl_common_run_done(q, pfield->evt, event, pmixer->is_async);
 
     return ret;
 }
@@ -0,0 +1,267 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_pyramid.hpp"
+
+#include <string.h>
+
+#include "impl_api.h"
+#include "impl_trace.hpp"
+
+/**
+ * Pyramid kernel. A work-group covers a PY_TILE_ROWS x PY_TILE_GROUPS * group_width source
+ * tile, it reads the tile once and averages 2x2 blocks of it into level 1 in local memory,
+ * then every further level from the one above. Each level is written out as soon as it
+ * is complete. Samples are kept in float, so level k is the mean of its 2^k x 2^k source
+ * block and is rounded once, when it is written.
+ */
+template <impl_video_format FORMAT>
+IMPL_STATUS impl_pyramid_kernel(struct impl_pyramid_params *ppy, impl_pyramid_context *pcontext,
+                                unsigned char *src_ptr, unsigned char *buf_levels[], void *dep_evt) {
+    IMPL_ASSERT(ppy->pq != NULL, "queue is null");
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    using fmt                       = rs_format<FORMAT>;
+    constexpr int group_width       = fmt::group_width;
+    constexpr int cshift            = fmt::is_420 ? 1 : 0;
+    constexpr uint32_t tile_w       = PY_TILE_GROUPS * group_width;
+    constexpr uint32_t tile_h       = PY_TILE_ROWS;
+    constexpr uint32_t tile_threads = PY_LOCAL_ROWS * PY_LOCAL_COLS;
+    const uint32_t src_width        = ppy->src_width;
+    const uint32_t src_height       = ppy->src_height;
+
+    struct py_kernel_params kparams;
+    kparams.num_levels = pcontext->num_levels;
+    for (int k = 0; k < pcontext->num_levels; k++) {
+        const struct impl_pyramid_level &l = pcontext->levels[k];
+        struct py_kernel_level &dst        = kparams.levels[k];
+        dst.buf                            = buf_levels[k];
+        dst.width                          = l.width;
+        dst.height                         = l.height;
+        dst.pitch                          = l.pitch_pixel;
+        dst.surface_height                 = l.surface_height;
+        dst.offset_x                       = l.offset_x;
+        dst.offset_y                       = l.offset_y;
+    }
+
+    queue q         = *(queue *)(ppy->pq);
+    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
+    auto event      = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            const uint32_t lm_size = py_level_offset(tile_w, tile_h, kparams.num_levels + 1);
+            const uint32_t c_size  = py_level_offset(tile_w / 2, tile_h >> cshift, kparams.num_levels + 1);
+            sycl::local_accessor<float, 1> lm_tile(sycl::range<1>(lm_size), h);
+            sycl::local_accessor<float, 1> cb_tile(sycl::range<1>(c_size), h);
+            sycl::local_accessor<float, 1> cr_tile(sycl::range<1>(c_size), h);
+            sycl::range<2> global((src_height + tile_h - 1) / tile_h * PY_LOCAL_ROWS,
+                                  (src_width + tile_w - 1) / tile_w * PY_LOCAL_COLS);
+            h.parallel_for(sycl::nd_range<2>(global, sycl::range<2>(PY_LOCAL_ROWS, PY_LOCAL_COLS)),
+                           [=](sycl::nd_item<2> item) {
+                const uint32_t tile_y      = item.get_group(0) * tile_h;
+                const uint32_t tile_x      = item.get_group(1) * tile_w;
+                const uint32_t lid         = item.get_local_linear_id();
+                const uint32_t src_cwidth  = src_width / 2;
+                const uint32_t src_cheight = src_height >> cshift;
+                // reads past the frame edge are clamped, the levels never use what they produce
+                auto readlm = [&](uint32_t y, uint32_t x) {
+                    return (float)fmt::read_lm(src_ptr, src_width, src_height, sycl::min(y, src_height - 1),
+                                               sycl::min(x, src_width - 1));
+                };
+                auto readcb = [&](uint32_t y, uint32_t x) {
+                    return (float)fmt::read_cb(src_ptr, src_width, src_height, sycl::min(y, src_cheight - 1),
+                                               sycl::min(x, src_cwidth - 1));
+                };
+                auto readcr = [&](uint32_t y, uint32_t x) {
+                    return (float)fmt::read_cr(src_ptr, src_width, src_height, sycl::min(y, src_cheight - 1),
+                                               sycl::min(x, src_cwidth - 1));
+                };
+
+                for (int k = 1; k <= kparams.num_levels; k++) {
+                    const uint32_t lw      = tile_w >> k;
+                    const uint32_t lh      = tile_h >> k;
+                    const uint32_t cw      = lw / 2;
+                    const uint32_t ch      = lh >> cshift;
+                    const uint32_t lm_cur  = py_level_offset(tile_w, tile_h, k);
+                    const uint32_t lm_prev = py_level_offset(tile_w, tile_h, k - 1);
+                    const uint32_t c_cur   = py_level_offset(tile_w / 2, tile_h >> cshift, k);
+                    const uint32_t c_prev  = py_level_offset(tile_w / 2, tile_h >> cshift, k - 1);
+
+                    for (uint32_t i = lid; i < lw * lh; i += tile_threads) {
+                        const uint32_t x = i % lw;
+                        const uint32_t y = i / lw;
+                        float sum;
+                        if (k == 1) {
+                            const uint32_t sx = tile_x + x * 2;
+                            const uint32_t sy = tile_y + y * 2;
+                            sum = readlm(sy, sx) + readlm(sy, sx + 1) + readlm(sy + 1, sx) + readlm(sy + 1, sx + 1);
+                        } else {
+                            const uint32_t p = lm_prev + y * 4 * lw + x * 2;
+                            sum = lm_tile[p] + lm_tile[p + 1] + lm_tile[p + lw * 2] + lm_tile[p + lw * 2 + 1];
+                        }
+                        lm_tile[lm_cur + i] = sum * 0.25f;
+                    }
+                    for (uint32_t i = lid; i < cw * ch; i += tile_threads) {
+                        const uint32_t x = i % cw;
+                        const uint32_t y = i / cw;
+                        float sum_cb, sum_cr;
+                        if (k == 1) {
+                            const uint32_t sx = tile_x / 2 + x * 2;
+                            const uint32_t sy = (tile_y >> cshift) + y * 2;
+                            sum_cb = readcb(sy, sx) + readcb(sy, sx + 1) + readcb(sy + 1, sx) + readcb(sy + 1, sx + 1);
+                            sum_cr = readcr(sy, sx) + readcr(sy, sx + 1) + readcr(sy + 1, sx) + readcr(sy + 1, sx + 1);
+                        } else {
+                            const uint32_t p = c_prev + y * 4 * cw + x * 2;
+                            sum_cb = cb_tile[p] + cb_tile[p + 1] + cb_tile[p + cw * 2] + cb_tile[p + cw * 2 + 1];
+                            sum_cr = cr_tile[p] + cr_tile[p + 1] + cr_tile[p + cw * 2] + cr_tile[p + cw * 2 + 1];
+                        }
+                        cb_tile[c_cur + i] = sum_cb * 0.25f;
+                        cr_tile[c_cur + i] = sum_cr * 0.25f;
+                    }
+                    sycl::group_barrier(item.get_group());
+
+                    const struct py_kernel_level &dst = kparams.levels[k - 1];
+                    const uint32_t groups             = lw / group_width;
+                    for (uint32_t i = lid; i < groups * lh; i += tile_threads) {
+                        const uint32_t x  = i % groups * group_width;
+                        const uint32_t y  = i / groups;
+                        const uint32_t sx = (tile_x >> k) + x;
+                        const uint32_t sy = (tile_y >> k) + y;
+                        if (sx >= dst.width || sy >= dst.height)
+                            continue;
+                        float lm[group_width];
+                        float cb[group_width / 2];
+                        float cr[group_width / 2];
+                        // rounded here, so every write() stores the same code whether it rounds or truncates
+#pragma unroll
+                        for (int j = 0; j < group_width; j++)
+                            lm[j] = sycl::floor(lm_tile[lm_cur + y * lw + x + j] + 0.5f);
+                        const uint32_t c = c_cur + (y >> cshift) * cw + x / 2;
+#pragma unroll
+                        for (int j = 0; j < group_width / 2; j++) {
+                            cb[j] = sycl::floor(cb_tile[c + j] + 0.5f);
+                            cr[j] = sycl::floor(cr_tile[c + j] + 0.5f);
+                        }
+                        fmt::write(dst.buf, dst.pitch, dst.surface_height, sx, sy, dst.offset_x, dst.offset_y, lm, cb,
+                                   cr, !fmt::is_420 || (sy % 2) == 0);
+                    }
+                }
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, ppy->evt, event, ppy->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*PYRAMID_function)(struct impl_pyramid_params *ppy, impl_pyramid_context *pcontext,
+                                        unsigned char *buf_in, unsigned char *buf_levels[], void *dep_evt);
+
+constexpr PYRAMID_function pyramidfunction[IMPL_VIDEO_MAX] = {impl_pyramid_kernel<IMPL_VIDEO_I420>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_V210>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_Y210>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_NV12>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_P010>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_YUV420P10LE>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_YUV422P10LE>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                              impl_pyramid_kernel<IMPL_VIDEO_YUV422YCBCR10LE>};
+
+IMPL_STATUS impl_pyramid_init(struct impl_pyramid_params *ppy, void *&ppy_context) {
+    IMPL_ASSERT(ppy != NULL, "pyramid init failed, ppy is null");
+    IMPL_ASSERT(ppy->pq != NULL, "pyramid init failed, pq is null");
+    if (ppy->format < 0 || ppy->format >= IMPL_VIDEO_MAX) {
+        err("%s, unsupported format %d\n", __func__, ppy->format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (ppy->num_levels < 1 || ppy->num_levels > IMPL_PYRAMID_MAX_LEVELS) {
+        err("%s, invalid number of levels %d\n", __func__, ppy->num_levels);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (ppy->src_width <= 0 || ppy->src_height <= 0 || (ppy->src_width % 2) != 0 || (ppy->src_height % 2) != 0) {
+        err("%s, Illegal size: The width and height must be a multiple of 2\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (IMPL_VIDEO_V210 == ppy->format && (ppy->src_width % 48) != 0) {
+        err("%s, Illegal V210 size: The width must be a multiple of 48\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    // x and widths stay whole pixel groups, y and heights whole 4:2:0 chroma rows
+    const int align_x = IMPL_VIDEO_V210 == ppy->format ? 6 : 2;
+    int width         = ppy->src_width;
+    int height        = ppy->src_height;
+    for (int k = 0; k < ppy->num_levels; k++) {
+        struct impl_pyramid_level &l = ppy->levels[k];
+        width                        = width / 2 / align_x * align_x;
+        height                       = height / 2 / 2 * 2;
+        if (width == 0 || height == 0) {
+            err("%s, level %d of a %dx%d source is empty\n", __func__, k, ppy->src_width, ppy->src_height);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+        l.width  = width;
+        l.height = height;
+        if (l.pitch_pixel == 0)
+            l.pitch_pixel = width;
+        if (l.surface_height == 0)
+            l.surface_height = height;
+        if (l.offset_x < 0 || l.offset_y < 0 || l.offset_x + width > l.pitch_pixel ||
+            l.offset_y + height > l.surface_height) {
+            err("%s, level %d of %dx%d at (%d, %d) is outside its %dx%d surface\n", __func__, k, width, height,
+                l.offset_x, l.offset_y, l.pitch_pixel, l.surface_height);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+        if ((l.offset_x % align_x) != 0 || (l.pitch_pixel % align_x) != 0 || (l.offset_y % 2) != 0) {
+            err("%s, level %d offset and pitch must be multiples of %d, offset_y of 2\n", __func__, k, align_x);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+    }
+
+    impl_pyramid_context *pcontext = new impl_pyramid_context;
+    memset(pcontext, 0, sizeof(impl_pyramid_context));
+    pcontext->num_levels = ppy->num_levels;
+    memcpy(pcontext->levels, ppy->levels, sizeof(ppy->levels));
+    ppy->evt    = impl_common_new_event();
+    ppy_context = (void *)pcontext;
+    return IMPL_STATUS_SUCCESS;
+}
+
+IMPL_STATUS impl_pyramid_run(struct impl_pyramid_params *ppy, void *ppy_context, unsigned char *buf_in,
+                             unsigned char *buf_levels[], void *dep_evt) {
+    IMPL_ASSERT(ppy != NULL, "pyramid run failed, ppy is null");
+    IMPL_ASSERT(ppy_context != NULL, "pyramid run failed, ppy_context is null");
+    struct impl_pyramid_context *pcontext = (struct impl_pyramid_context *)ppy_context;
+    if (buf_levels == NULL) {
+        err("%s, buf_levels is null\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    for (int k = 0; k < pcontext->num_levels; k++) {
+        if (buf_levels[k] == NULL) {
+            err("%s, buffer of level %d is null\n", __func__, k);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+    }
+    IMPL_STATUS ret = pyramidfunction[ppy->format](ppy, pcontext, buf_in, buf_levels, dep_evt);
+    IMPL_ASSERT(ret >= 0, "pyramid function failed");
+    return ret;
+}
+
+IMPL_STATUS impl_pyramid_run_evt(struct impl_pyramid_params *ppy, void *ppy_context, unsigned char *buf_in,
+                                 unsigned char *buf_levels[], void *dep_evt, void *&evt) {
+    IMPL_ASSERT(ppy != NULL, "pyramid run failed, ppy is null");
+    return impl_common_run_evt(ppy, evt, impl_pyramid_run, ppy_context, buf_in, buf_levels, dep_evt);
+}
+
+IMPL_STATUS impl_pyramid_uninit(struct impl_pyramid_params *ppy, void *ppy_context) {
+    IMPL_ASSERT(ppy != NULL, "pyramid uninit failed, ppy is null");
+    IMPL_ASSERT(ppy_context != NULL, "pyramid uninit failed, ppy_context is null");
+    impl_common_free_event(ppy->evt);
+    delete (struct impl_pyramid_context *)ppy_context;
+    return IMPL_STATUS_SUCCESS;
+}
@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_PYRAMID_HPP__
+#define __IMPL_PYRAMID_HPP__
+
+#include "impl_common.hpp"
+#include "impl_resize_format.hpp"
+
+/* source rows covered by one work-group, the last level keeps 2 rows of it */
+#define PY_TILE_ROWS 32
+/* source pixel groups per tile row, in units of rs_format<>::group_width */
+#define PY_TILE_GROUPS 32
+/* work-group size */
+#define PY_LOCAL_ROWS 8
+#define PY_LOCAL_COLS 32
+
+/* level destination, passed by value into the kernel */
+struct py_kernel_level {
+    unsigned char *buf;
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;
+    uint32_t surface_height;
+    uint32_t offset_x;
+    uint32_t offset_y;
+};
+
+struct py_kernel_params {
+    int num_levels;
+    struct py_kernel_level levels[IMPL_PYRAMID_MAX_LEVELS];
+};
+
+struct impl_pyramid_context {
+    /** number of levels */
+    int num_levels;
+    /** level geometry checked by impl_pyramid_init */
+    struct impl_pyramid_level levels[IMPL_PYRAMID_MAX_LEVELS];
+};
+
+/* samples of levels 1 .. level - 1 of a w x h tile, where level is stored in local memory */
+static inline uint32_t py_level_offset(uint32_t w, uint32_t h, int level) {
+    uint32_t offset = 0;
+    for (int k = 1; k < level; k++)
+        offset += (w >> k) * (h >> k);
+    return offset;
+}
+
+#endif
@@ -42,40 +42,184 @@ void impl_init_resize_index_table_y210(struct impl_resize_params *prs, impl_resi
     (void)prst;
 }
 
+void impl_init_resize_index_table_generic(struct impl_resize_params *prs, impl_resize_context *prst) {
+    IMPL_ASSERT(prs->pq != NULL, "resize index table init failed, queue is null");
+    (void)prs;
+    (void)prst;
+}
+
 typedef IMPL_STATUS (*RS_Function)(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *buf_in,
                                    unsigned char *buf_out, void *dep_evt);
-constexpr RS_Function ResizeFunctionList[18] = {
+constexpr RS_Function ResizeFunctionList[IMPL_VIDEO_MAX * IMPL_INTERP_MTD_MAX] = {
     impl_resize_i420<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_I420
     impl_resize_i420<IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_i420<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_i420<IMPL_INTERP_MTD_AREA>,
     impl_resize_v210<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_V210
     impl_resize_v210<IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_v210<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_v210<IMPL_INTERP_MTD_AREA>,
     impl_resize_y210<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_Y210
     impl_resize_y210<IMPL_INTERP_MTD_BICUBIC>,
-    NULL, // IMPL_VIDEO_NV12
-    NULL,
+    impl_resize_y210<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_y210<IMPL_INTERP_MTD_AREA>,
+    impl_resize_generic<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_NV12
+    impl_resize_generic<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_generic<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_generic<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_AREA>,
     impl_resize_p010<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_P010
     impl_resize_p010<IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_p010<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_p010<IMPL_INTERP_MTD_AREA>,
     impl_resize_yuv420p10le<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV420P10LE
     impl_resize_yuv420p10le<IMPL_INTERP_MTD_BICUBIC>,
-    NULL, // IMPL_VIDEO_YUV422P10LE
-    NULL,
+    impl_resize_yuv420p10le<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_yuv420p10le<IMPL_INTERP_MTD_AREA>,
+    impl_resize_generic<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422P10LE
+    impl_resize_generic<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_generic<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_generic<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_AREA>,
     impl_resize_yuv422ycbcr10be<IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422YCBCR10BE
     impl_resize_yuv422ycbcr10be<IMPL_INTERP_MTD_BICUBIC>,
-    NULL, // IMPL_VIDEO_YUV422YCBCR10LE
+    impl_resize_yuv422ycbcr10be<IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_yuv422ycbcr10be<IMPL_INTERP_MTD_AREA>,
+    impl_resize_generic<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422YCBCR10LE
+    impl_resize_generic<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_generic<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_NEAREST>,
+    impl_resize_generic<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_AREA>};
+
+/* bicubic resize, separable kernels indexed by format */
+constexpr RS_Function SeparableFunctionList[IMPL_VIDEO_MAX] = {
+    impl_resize_separable<IMPL_VIDEO_I420, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_V210, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_Y210, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_P010, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_YUV420P10LE, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_YUV422YCBCR10BE, IMPL_INTERP_MTD_BICUBIC>,
+    impl_resize_separable<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BICUBIC>
+};
+
+/* fixed-point resize, indexed as ResizeFunctionList */
+constexpr RS_Function FixedFunctionList[IMPL_VIDEO_MAX * IMPL_INTERP_MTD_MAX] = {
+    impl_resize_fixed<IMPL_VIDEO_I420, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_I420
+    impl_resize_fixed<IMPL_VIDEO_I420, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_V210, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_V210
+    impl_resize_fixed<IMPL_VIDEO_V210, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_Y210, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_Y210
+    impl_resize_fixed<IMPL_VIDEO_Y210, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_NV12
+    impl_resize_fixed<IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_P010, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_P010
+    impl_resize_fixed<IMPL_VIDEO_P010, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_YUV420P10LE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV420P10LE
+    impl_resize_fixed<IMPL_VIDEO_YUV420P10LE, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422P10LE
+    impl_resize_fixed<IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_YUV422YCBCR10BE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422YCBCR10BE
+    impl_resize_fixed<IMPL_VIDEO_YUV422YCBCR10BE, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
+    NULL,
+    impl_resize_fixed<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BILINEAR>, // IMPL_VIDEO_YUV422YCBCR10LE
+    impl_resize_fixed<IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BICUBIC>,
+    NULL,
     NULL};
 
+/* integer ratio resize, indexed as ResizeFunctionList and by rs_ratio */
+#define RS_RATIO_FUNCTIONS(FORMAT, INTERP)                                                                             \
+    {impl_resize_generic<FORMAT, INTERP, 1, 2>, impl_resize_generic<FORMAT, INTERP, 1, 4>,                             \
+     impl_resize_generic<FORMAT, INTERP, 2, 1>}
+constexpr RS_Function RatioFunctionList[IMPL_VIDEO_MAX * IMPL_INTERP_MTD_MAX][RS_RATIO_NONE] = {
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_I420, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_I420
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_I420, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_V210, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_V210
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_V210, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_Y210, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_Y210
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_Y210, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_NV12
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_NV12, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_P010, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_P010
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_P010, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV420P10LE, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_YUV420P10LE
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV420P10LE, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_YUV422P10LE
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422P10LE, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10BE, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_YUV422YCBCR10BE
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10BE, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL},
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BILINEAR), // IMPL_VIDEO_YUV422YCBCR10LE
+    RS_RATIO_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10LE, IMPL_INTERP_MTD_BICUBIC),
+    {NULL, NULL, NULL},
+    {NULL, NULL, NULL}};
+
+/* rs_ratio of the resize, the same integer ratio is needed on both axes */
+static int impl_resize_get_ratio(const struct impl_resize_params *prs) {
+    const int sw = prs->src_width, sh = prs->src_height;
+    const int dw = prs->dst_width, dh = prs->dst_height;
+    if (sw == dw * 2 && sh == dh * 2)
+        return RS_RATIO_DOWN2;
+    if (sw == dw * 4 && sh == dh * 4)
+        return RS_RATIO_DOWN4;
+    if (dw == sw * 2 && dh == sh * 2)
+        return RS_RATIO_UP2;
+    return RS_RATIO_NONE;
+}
+
+/* the source crop is read per run, it has to stay inside the source frame */
+static IMPL_STATUS impl_resize_check_crop(const struct impl_resize_params *prs) {
+    if (prs->crop_w == 0 && prs->crop_h == 0 && prs->crop_x == 0 && prs->crop_y == 0)
+        return IMPL_STATUS_SUCCESS;
+    if (!(prs->crop_x >= 0 && prs->crop_y >= 0 && prs->crop_w > 0 && prs->crop_h > 0 &&
+          prs->crop_x + prs->crop_w <= (float)prs->src_width && prs->crop_y + prs->crop_h <= (float)prs->src_height)) {
+        err("%s, invalid source crop %f,%f %fx%f of %dx%d\n", __func__, prs->crop_x, prs->crop_y, prs->crop_w,
+            prs->crop_h, prs->src_width, prs->src_height);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    return IMPL_STATUS_SUCCESS;
+}
+
 IMPL_STATUS impl_resize_init(struct impl_resize_params *prs, void *&prs_context) {
     typedef void (*Table_init_function)(struct impl_resize_params * prs, impl_resize_context * prst);
     constexpr Table_init_function Table_init_function_list[9] = {
         impl_init_resize_index_table_yuv420p,         // IMPL_VIDEO_I420
         impl_init_resize_index_table_V210,            // IMPL_VIDEO_V210
         impl_init_resize_index_table_y210,            // IMPL_VIDEO_Y210
-        NULL,                                         // IMPL_VIDEO_NV12
+        impl_init_resize_index_table_generic,         // IMPL_VIDEO_NV12
         impl_init_resize_index_table_p010,            // IMPL_VIDEO_P010
         impl_init_resize_index_table_yuv420p,         // IMPL_VIDEO_YUV420P10LE
-        NULL,                                         // IMPL_VIDEO_YUV422P10LE
+        impl_init_resize_index_table_generic,         // IMPL_VIDEO_YUV422P10LE
         impl_init_resize_index_table_yuv422ycbcr10be, // impl_init_resize_index_table_yuv422ycbcr10be
-        NULL                                          // IMPL_VIDEO_YUV422YCBCR10LE
+        impl_init_resize_index_table_generic          // IMPL_VIDEO_YUV422YCBCR10LE
     };
 
     IMPL_ASSERT(prs != NULL, "resize init failed, prs is null");
@@ -108,7 +252,33 @@ IMPL_STATUS impl_resize_init(struct impl_resize_params *prs, void *&prs_context)
         return IMPL_STATUS_FAIL;
     }
 
-    prst->resize_func_index = (int)prs->format * 2 + (int)prs->interp_mtd;
+    if (prs->interp_arith < 0 || prs->interp_arith >= IMPL_INTERP_ARITH_MAX) {
+        err("%s, invalid interpolation arithmetic %d\n", __func__, prs->interp_arith);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    if (prs->interp_mtd < 0 || prs->interp_mtd >= IMPL_INTERP_MTD_MAX) {
+        err("%s, invalid interpolation method %d\n", __func__, prs->interp_mtd);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+
+    prst->resize_func_index = (int)prs->format * IMPL_INTERP_MTD_MAX + (int)prs->interp_mtd;
+    // nearest and area have no fixed-point or integer ratio kernels
+    if (prs->interp_arith == IMPL_INTERP_ARITH_FIXED && FixedFunctionList[prst->resize_func_index] == NULL) {
+        err("%s, fixed-point arithmetic is only supported for bilinear and bicubic, method %d\n", __func__,
+            prs->interp_mtd);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    prst->is_fixed = prs->interp_arith == IMPL_INTERP_ARITH_FIXED;
+    prst->ratio    = impl_resize_get_ratio(prs);
+    if (prst->is_fixed || RatioFunctionList[prst->resize_func_index][0] == NULL)
+        prst->ratio = RS_RATIO_NONE;
+    prst->is_separable = !prst->is_fixed && prs->interp_mtd == IMPL_INTERP_MTD_BICUBIC &&
+                         SeparableFunctionList[prs->format] != NULL;
+    // the runs check the crop and compute the interior again whenever it changes
+    prst->interior.crop_w = -1;
+    if (impl_resize_check_crop(prs) == IMPL_STATUS_SUCCESS)
+        rs_update_interior(prs, prst->interior);
     init_table(prs, prst);
     return IMPL_STATUS_SUCCESS;
 }
@@ -118,17 +288,79 @@ IMPL_STATUS impl_resize_run(struct impl_resize_params *prs, void *prs_context, u
     IMPL_STATUS ret           = IMPL_STATUS_SUCCESS;
     impl_resize_context *prst = (impl_resize_context *)prs_context;
 
-    ret = ResizeFunctionList[prst->resize_func_index](prs, prst, buf_in, buf_out, dep_evt);
+    ret = impl_resize_check_crop(prs);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    rs_update_interior(prs, prst->interior);
+    // the crop may change every run. Bicubic prefers the separable kernel, also for integer ratios, its
+    // local tile covers vertical ratios up to RS_SEPARABLE_MAX_COEF and it does not write aspect_fit bars.
+    // The integer ratio kernels only map the whole source to the whole destination
+    if (prst->is_fixed)
+        ret = FixedFunctionList[prst->resize_func_index](prs, prst, buf_in, buf_out, dep_evt);
+    else if (prst->is_separable && !prs->aspect_fit && rs_coef_height(prs) <= RS_SEPARABLE_MAX_COEF)
+        ret = SeparableFunctionList[prs->format](prs, prst, buf_in, buf_out, dep_evt);
+    else if (prst->ratio != RS_RATIO_NONE && !rs_is_cropped(prs) && !prs->aspect_fit)
+        ret = RatioFunctionList[prst->resize_func_index][prst->ratio](prs, prst, buf_in, buf_out, dep_evt);
+    else
+        ret = ResizeFunctionList[prst->resize_func_index](prs, prst, buf_in, buf_out, dep_evt);
     IMPL_ASSERT(ret >= 0, "resize run failed");
     return ret;
 }
 
+IMPL_STATUS impl_resize_run_evt(struct impl_resize_params *prs, void *prs_context, unsigned char *buf_in,
+                                unsigned char *buf_out, void *dep_evt, void *&evt) {
+    IMPL_ASSERT(prs != NULL, "resize run failed, prs is null");
+    return impl_common_run_evt(prs, evt, impl_resize_run, prs_context, buf_in, buf_out, dep_evt);
+}
+
 IMPL_STATUS impl_resize_uninit(struct impl_resize_params *prs, void *prs_context) {
     IMPL_ASSERT(prs->pq, "resize uninit fail, queue is null");
     queue q = *(queue *)(prs->pq);
     impl_common_free_event(prs->evt);
     impl_resize_context *prst = (impl_resize_context *)prs_context;
+    impl_sg_free(prs->pq, prst->sg_index);
     delete prst;
 
     return IMPL_STATUS_SUCCESS;
 }
+
+IMPL_STATUS impl_resize_sg_run(struct impl_resize_params *prs, void *prs_context, struct impl_sg_input *pin,
+                               unsigned char *buf_out, void *dep_evt) {
+    IMPL_ASSERT(prs != NULL, "resize sg run failed, prs is null");
+    IMPL_ASSERT(prs_context != NULL, "resize sg run failed, prs_context is null");
+    impl_resize_context *prst = (impl_resize_context *)prs_context;
+    if (prs->format != IMPL_VIDEO_YUV422YCBCR10BE) {
+        err("%s, scatter-gather input must be yuv422ycbcr10be, got %d\n", __func__, prs->format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    IMPL_STATUS ret = impl_sg_check(pin, prs->src_width, prs->src_height);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    ret = impl_resize_check_crop(prs);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    rs_update_interior(prs, prst->interior);
+
+    struct sg_kernel_src src;
+    sycl::event index_evt;
+    ret = impl_sg_index(prs->pq, pin, prs->src_width, prs->src_height, prst->sg_index, src, dep_evt, index_evt);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+    switch (prs->interp_mtd) {
+    case IMPL_INTERP_MTD_BICUBIC:
+        ret = impl_resize_yuv422ycbcr10be_sg<IMPL_INTERP_MTD_BICUBIC>(prs, prst, src, buf_out, index_evt);
+        break;
+    case IMPL_INTERP_MTD_NEAREST:
+        ret = impl_resize_yuv422ycbcr10be_sg<IMPL_INTERP_MTD_NEAREST>(prs, prst, src, buf_out, index_evt);
+        break;
+    case IMPL_INTERP_MTD_AREA:
+        ret = impl_resize_yuv422ycbcr10be_sg<IMPL_INTERP_MTD_AREA>(prs, prst, src, buf_out, index_evt);
+        break;
+    default:
+        ret = impl_resize_yuv422ycbcr10be_sg<IMPL_INTERP_MTD_BILINEAR>(prs, prst, src, buf_out, index_evt);
+        break;
+    }
+    IMPL_ASSERT(ret >= 0, "resize sg run failed");
+    impl_sg_gathered(prs->pq, prst->sg_index, prs->evt);
+    return ret;
+}
@@ -8,12 +8,43 @@
 #include <CL/sycl.hpp>
 
 #include "impl_api.h"
+#include "impl_sg.hpp"
 
 using namespace sycl;
 
+/* integer resize ratios with a specialized kernel, same on both axes */
+enum rs_ratio { RS_RATIO_DOWN2 = 0, RS_RATIO_DOWN4, RS_RATIO_UP2, RS_RATIO_NONE };
+
+/* work items or pixels [x0, x1) x [y0, y1) of a resize */
+struct rs_region {
+    uint32_t x0, y0, x1, y1;
+};
+
+/**
+ * Destination pixels whose taps stay inside the source, luma in luma pixels and chroma in
+ * chroma pixels, and the crop and aspect_fit they were computed for, crop_w is negative
+ * until they are computed.
+ */
+struct rs_interior {
+    float crop_x, crop_y, crop_w, crop_h;
+    bool aspect_fit;
+    struct rs_region luma;
+    struct rs_region chroma;
+};
+
 struct impl_resize_context {
     /** IMPL resize functon index*/
     int resize_func_index;
+    /** use the separable bicubic kernel */
+    bool is_separable;
+    /** use the fixed-point kernel */
+    bool is_fixed;
+    /** rs_ratio of an integer ratio resize, RS_RATIO_NONE for any other ratio */
+    int ratio;
+    /** per line segment index of the scatter-gather input */
+    struct sg_index sg_index;
+    /** interior of the split kernels, computed by impl_resize_init and again when the crop changes */
+    struct rs_interior interior;
 };
 
 template <impl_interp_mtd INTERP_METHOD> constexpr int GetDataSize() {
@@ -21,46 +52,247 @@ template <impl_interp_mtd INTERP_METHOD> constexpr int GetDataSize() {
         return 2;
     else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
         return 4;
+    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_NEAREST)
+        return 1;
+    // first and last tap of the box with their weights, and the weight of the taps in between
+    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_AREA)
+        return 3;
 }
 
-template <impl_interp_mtd INTERP_METHOD>
-inline void get_idw(uint32_t dstid, float coef, uint32_t limit, uint32_t *id, float *weight) {
-    (void)dstid;
-    (void)coef;
-    (void)limit;
-    (void)id;
-    (void)weight;
-    exit(-1);
+/* a source crop is applied when both its width and height are set */
+inline bool rs_is_cropped(const struct impl_resize_params *prs) { return prs->crop_w > 0 && prs->crop_h > 0; }
+
+/* image rectangle inside the dst_width x dst_height destination */
+struct rs_rect {
+    uint32_t x, y, w, h;
+};
+
+/**
+ * The whole destination, or with aspect_fit the largest rectangle of the source (or crop)
+ * aspect ratio centered in it. Width and x are kept multiples of the 6 pixel v210 group
+ * or of 2, height and y multiples of 2.
+ */
+inline struct rs_rect rs_fit_rect(const struct impl_resize_params *prs) {
+    const uint32_t dw = prs->dst_width, dh = prs->dst_height;
+    if (!prs->aspect_fit)
+        return {0, 0, dw, dh};
+    const uint32_t align = prs->format == IMPL_VIDEO_V210 ? 6 : 2;
+    const float sw       = rs_is_cropped(prs) ? prs->crop_w : (float)prs->src_width;
+    const float sh       = rs_is_cropped(prs) ? prs->crop_h : (float)prs->src_height;
+    uint32_t w = dw, h = dh;
+    if (sw * (float)dh > sh * (float)dw)
+        h = sycl::max((uint32_t)((float)dw * sh / sw + (float)0.5) / 2 * 2, (uint32_t)2);
+    else
+        w = sycl::max((uint32_t)((float)dh * sw / sh + (float)0.5) / align * align, align);
+    return {(dw - w) / 2 / align * align, (dh - h) / 2 / 2 * 2, w, h};
+}
+
+/* size and position in the output surface of the resized image */
+inline uint32_t rs_dst_width(const struct impl_resize_params *prs) { return rs_fit_rect(prs).w; }
+
+inline uint32_t rs_dst_height(const struct impl_resize_params *prs) { return rs_fit_rect(prs).h; }
+
+inline uint32_t rs_offset_x(const struct impl_resize_params *prs) { return prs->offset_x + rs_fit_rect(prs).x; }
+
+inline uint32_t rs_offset_y(const struct impl_resize_params *prs) { return prs->offset_y + rs_fit_rect(prs).y; }
+
+/* source pixels per destination pixel, of the crop or of the whole source */
+inline float rs_coef_width(const struct impl_resize_params *prs) {
+    return rs_is_cropped(prs) ? prs->crop_w / (float)rs_dst_width(prs)
+                              : (float)prs->src_width / (float)rs_dst_width(prs);
+}
+
+inline float rs_coef_height(const struct impl_resize_params *prs) {
+    return rs_is_cropped(prs) ? prs->crop_h / (float)rs_dst_height(prs)
+                              : (float)prs->src_height / (float)rs_dst_height(prs);
+}
+
+/* source position of the left and top destination edge, the origin get_idw maps from */
+inline float rs_origin_x(const struct impl_resize_params *prs) { return rs_is_cropped(prs) ? prs->crop_x : (float)0; }
+
+inline float rs_origin_y(const struct impl_resize_params *prs) { return rs_is_cropped(prs) ? prs->crop_y : (float)0; }
+
+/**
+ * Destination pixels [first, last) of dst whose taps are all inside the limit pixels of the
+ * source. The footprint of pixel d spans the taps from source position d * coef + a to
+ * d * coef + b, which must stay in [lo, hi). One more source tap on both sides is kept as
+ * guard, the device may round a position into the neighbouring tap.
+ */
+inline void rs_interior_axis(impl_interp_mtd mtd, uint32_t dst, float coef, uint32_t limit, float origin,
+                             uint32_t &first, uint32_t &last) {
+    const float center = (float)0.5 * coef - (float)0.5 + origin;
+    float a = center, b = center, lo = 0, hi = (float)limit - 1;
+    if (mtd == IMPL_INTERP_MTD_BICUBIC) {
+        // taps floor(s) - 1 .. floor(s) + 2
+        lo = 1;
+        hi = (float)limit - 2;
+    } else if (mtd == IMPL_INTERP_MTD_NEAREST) {
+        // tap floor(s) of the unshifted center
+        a = b = (float)0.5 * coef + origin;
+        hi    = (float)limit;
+    } else if (mtd == IMPL_INTERP_MTD_AREA) {
+        // taps of the box [d * coef, (d + 1) * coef)
+        a  = origin;
+        b  = coef + origin;
+        hi = (float)limit;
+    }
+    lo += 1;
+    hi -= 1;
+    first = (uint32_t)sycl::clamp(sycl::ceil((lo - a) / coef), (float)0, (float)dst);
+    last  = (uint32_t)sycl::clamp(sycl::ceil((hi - b) / coef), (float)first, (float)dst);
+}
+
+/* chroma is subsampled vertically */
+inline bool rs_is_420(impl_video_format format) {
+    return format == IMPL_VIDEO_I420 || format == IMPL_VIDEO_NV12 || format == IMPL_VIDEO_P010 ||
+           format == IMPL_VIDEO_YUV420P10LE;
+}
+
+/* computes the interior for the crop and aspect_fit of prs, unless it already is for them */
+inline void rs_update_interior(const struct impl_resize_params *prs, struct rs_interior &in) {
+    if (in.crop_x == prs->crop_x && in.crop_y == prs->crop_y && in.crop_w == prs->crop_w &&
+        in.crop_h == prs->crop_h && in.aspect_fit == prs->aspect_fit)
+        return;
+    const float coef_width  = rs_coef_width(prs);
+    const float coef_height = rs_coef_height(prs);
+    const float origin_x    = rs_origin_x(prs);
+    const float origin_y    = rs_origin_y(prs);
+    const uint32_t dw       = rs_dst_width(prs);
+    const uint32_t dh       = rs_dst_height(prs);
+    const uint32_t cdiv     = rs_is_420(prs->format) ? 2 : 1;
+    const impl_interp_mtd m = prs->interp_mtd;
+
+    rs_interior_axis(m, dw, coef_width, prs->src_width, origin_x, in.luma.x0, in.luma.x1);
+    rs_interior_axis(m, dw / 2, coef_width, prs->src_width / 2, origin_x / 2, in.chroma.x0, in.chroma.x1);
+    rs_interior_axis(m, dh, coef_height, prs->src_height, origin_y, in.luma.y0, in.luma.y1);
+    rs_interior_axis(m, dh / cdiv, coef_height, prs->src_height / cdiv, origin_y / cdiv, in.chroma.y0,
+                     in.chroma.y1);
+    in.crop_x     = prs->crop_x;
+    in.crop_y     = prs->crop_y;
+    in.crop_w     = prs->crop_w;
+    in.crop_h     = prs->crop_h;
+    in.aspect_fit = prs->aspect_fit;
+}
+
+/* tap weights at fractional source position t */
+template <impl_interp_mtd INTERP_METHOD> inline void get_weight(float t, float *weight) {
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR) {
+        weight[1] = t;
+        weight[0] = (float)1.0 - weight[1];
+    } else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC) {
+        float t2  = t * t;
+        float t3  = t2 * t;
+        weight[0] = t2 - (float)0.5 * t - (float)0.5 * t3;
+        weight[1] = (float)1 - (float)2.5 * t2 + (float)1.5 * t3;
+        weight[2] = (float)0.5 * t + (float)2 * t2 - (float)1.5 * t3;
+        weight[3] = (float)0.5 * t3 - (float)0.5 * t2;
+    }
+}
+
+/* tap index, clamped to the source edge unless the caller knows the tap is inside */
+template <bool CLAMP> inline uint32_t rs_tap(int id, uint32_t limit) {
+    if constexpr (CLAMP)
+        return sycl::clamp<int>(id, 0, limit - 1);
+    else
+        return (uint32_t)id;
 }
 
-template <>
-inline void get_idw<IMPL_INTERP_MTD_BILINEAR>(uint32_t dstid, float coef, uint32_t limit, uint32_t *id, float *weight) {
-    float srcid = ((float)dstid + (float)0.5) * coef - (float)0.5;
-    float t;
-    weight[1] = sycl::fract(srcid, &t);
-    weight[0] = (float)1.0 - weight[1];
+/**
+ * Source taps and weights of destination pixel dstid. Bilinear and bicubic sample at
+ * the pixel center, nearest takes the pixel the center falls in, and area takes the box
+ * [dstid * coef, (dstid + 1) * coef) with the covered part of every tap as weight, the
+ * first and last tap in id[0] and id[1] and the weight of the taps in between in
+ * weight[2]. CLAMP = false skips clamping the taps to the source, only for pixels whose
+ * taps are known to be inside.
+ */
+template <impl_interp_mtd INTERP_METHOD, bool CLAMP = true>
+inline void get_idw(uint32_t dstid, float coef, uint32_t limit, uint32_t *id, float *weight, float origin) {
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR) {
+        float srcid = ((float)dstid + (float)0.5) * coef - (float)0.5 + origin;
+        float t;
+        get_weight<IMPL_INTERP_MTD_BILINEAR>(sycl::fract(srcid, &t), weight);
+
+        id[0] = rs_tap<CLAMP>((int)t, limit);
+        id[1] = rs_tap<CLAMP>((int)t + 1, limit);
+    } else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC) {
+        float srcid = ((float)dstid + (float)0.5) * coef - (float)0.5 + origin;
+        float t, fsrcid;
+        t = sycl::fract(srcid, &fsrcid);
+        get_weight<IMPL_INTERP_MTD_BICUBIC>(t, weight);
 
-    id[0] = sycl::clamp<int>(t, 0, limit - 1);
-    id[1] = sycl::clamp<int>(t + 1, 0, limit - 1);
+        id[0] = rs_tap<CLAMP>((int)fsrcid - 1, limit);
+        id[1] = rs_tap<CLAMP>((int)fsrcid, limit);
+        id[2] = rs_tap<CLAMP>((int)fsrcid + 1, limit);
+        id[3] = rs_tap<CLAMP>((int)fsrcid + 2, limit);
+    } else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_NEAREST) {
+        float srcid = ((float)dstid + (float)0.5) * coef + origin;
+        id[0]       = rs_tap<CLAMP>((int)sycl::floor(srcid), limit);
+        weight[0]   = (float)1;
+    } else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_AREA) {
+        float first = (float)dstid * coef + origin;
+        float last  = ((float)dstid + (float)1) * coef + origin;
+        float inv   = (float)1 / coef;
+
+        id[0] = rs_tap<CLAMP>((int)sycl::floor(first), limit);
+        if constexpr (CLAMP)
+            id[1] = sycl::clamp<int>(sycl::ceil(last) - 1, id[0], limit - 1);
+        else
+            id[1] = (uint32_t)((int)sycl::ceil(last) - 1);
+        if (id[0] == id[1]) {
+            weight[0] = (float)1;
+            weight[1] = (float)0;
+            weight[2] = (float)0;
+        } else {
+            weight[0] = ((float)id[0] + (float)1 - first) * inv;
+            weight[1] = (sycl::min(last, (float)limit) - (float)id[1]) * inv;
+            weight[2] = inv;
+        }
+    }
 }
 
-template <>
-inline void get_idw<IMPL_INTERP_MTD_BICUBIC>(uint32_t dstid, float coef, uint32_t limit, uint32_t *id, float *weight) {
-    float srcid = ((float)dstid + (float)0.5) * coef - (float)0.5;
-    float t, fsrcid;
-    t = sycl::fract(srcid, &fsrcid);
+/**
+ * Source taps and weights at source position srcid, pixel centers at whole numbers, for
+ * mappings that are not a scale of the destination id, e.g. a warp. Taps are clamped to
+ * the source. Area has no footprint at a single position and is not supported.
+ */
+template <impl_interp_mtd INTERP_METHOD>
+inline void get_idw_at(float srcid, uint32_t limit, uint32_t *id, float *weight) {
+    static_assert(INTERP_METHOD != IMPL_INTERP_MTD_AREA, "area needs a box, not a position");
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_NEAREST) {
+        id[0]     = rs_tap<true>((int)sycl::floor(srcid + (float)0.5), limit);
+        weight[0] = (float)1;
+    } else {
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        float fsrcid;
+        get_weight<INTERP_METHOD>(sycl::fract(srcid, &fsrcid), weight);
+        const int first = (int)fsrcid - (datasize / 2 - 1);
+#pragma unroll
+        for (int i = 0; i < datasize; i++)
+            id[i] = rs_tap<true>(first + i, limit);
+    }
+}
 
-    float t2  = t * t;
-    float t3  = t2 * t;
-    weight[0] = t2 - (float)0.5 * t - (float)0.5 * t3;
-    weight[1] = (float)1 - (float)2.5 * t2 + (float)1.5 * t3;
-    weight[2] = (float)0.5 * t + (float)2 * t2 - (float)1.5 * t3;
-    weight[3] = (float)0.5 * t3 - (float)0.5 * t2;
+/**
+ * get_idw for an integer ratio, UP:1 upscale or 1:DOWN downscale. The source position
+ * is computed exactly in integers, it has 2 * UP phases whose weights are constants,
+ * and taps are strided by DOWN. Ids and weights are the same as get_idw's.
+ */
+template <impl_interp_mtd INTERP_METHOD, int UP, int DOWN, bool CLAMP = true>
+inline void get_idw_ratio(uint32_t dstid, uint32_t limit, uint32_t *id, float *weight) {
+    constexpr int datasize = GetDataSize<INTERP_METHOD>();
+    constexpr int phases   = 2 * UP;
+    // srcid = ((dstid + 0.5) * DOWN / UP - 0.5) = num / phases
+    const int num  = (int)(2 * dstid + 1) * DOWN - UP;
+    const int base = (num >= 0 ? num : num - phases + 1) / phases;
+    if constexpr (UP == 1)
+        get_weight<INTERP_METHOD>((float)(1 - DOWN % 2) / (float)2, weight);
+    else
+        get_weight<INTERP_METHOD>((float)(num - base * phases) / (float)phases, weight);
 
-    id[0] = sycl::clamp<int>(fsrcid - 1, 0, limit - 1);
-    id[1] = sycl::clamp<int>(fsrcid, 0, limit - 1);
-    id[2] = sycl::clamp<int>(fsrcid + 1, 0, limit - 1);
-    id[3] = sycl::clamp<int>(fsrcid + 2, 0, limit - 1);
+    const int first = base - (datasize / 2 - 1);
+#pragma unroll
+    for (int i = 0; i < datasize; i++)
+        id[i] = rs_tap<CLAMP>(first + i, limit);
 }
 
 // read(yid, xid) -> float
@@ -98,6 +330,32 @@ inline float pixel_interp_bicubic(uint32_t xid[4], float xw[4], uint32_t yid[4],
     return result;
 }
 
+// read(yid, xid) -> float, ids and weights from get_idw<IMPL_INTERP_MTD_AREA>
+template <class Func>
+inline float pixel_interp_area(uint32_t xid[3], float xw[3], uint32_t yid[3], float yw[3], Func read) {
+    float result = 0;
+    for (uint32_t y = yid[0]; y <= yid[1]; y++) {
+        float row = 0;
+        for (uint32_t x = xid[0]; x <= xid[1]; x++)
+            row += (float)read(y, x) * (x == xid[0] ? xw[0] : (x == xid[1] ? xw[1] : xw[2]));
+        result += row * (y == yid[0] ? yw[0] : (y == yid[1] ? yw[1] : yw[2]));
+    }
+    return result;
+}
+
+// read(yid, xid) -> float
+template <impl_interp_mtd INTERP_METHOD, class Func>
+inline float pixel_interp(uint32_t xid[], float xw[], uint32_t yid[], float yw[], Func read) {
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
+        return pixel_interp_bilinear(xid, xw, yid, yw, read);
+    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
+        return pixel_interp_bicubic(xid, xw, yid, yw, read);
+    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_NEAREST)
+        return (float)read(yid[0], xid[0]);
+    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_AREA)
+        return pixel_interp_area(xid, xw, yid, yw, read);
+}
+
 inline ushort read_yuv422ycbcr10be_lm(uint32_t x, uint32_t y, unsigned char *src_ptr, uint32_t src_pitch) {
     constexpr uchar idx_tab[2]   = {1, 3};
     constexpr uchar shift_tab[2] = {4, 8};
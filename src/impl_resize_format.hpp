@@ -0,0 +1,208 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+#pragma once
+
+#include "impl_csc_pixel.hpp"
+#include "impl_resize.hpp"
+
+/**
+ * Format traits used by the format-generic resize kernels.
+ *
+ * Samples are read and written in the native bit depth of the format, a work item
+ * produces group_width luma pixels of one row and the chroma sharing them. 4:2:0
+ * formats write chroma from even rows only. Addressing and rounding of write() are
+ * the same as the dedicated per format kernels. bit_depth is the sample depth read_*()
+ * returns.
+ */
+template <impl_video_format FORMAT> struct rs_format;
+
+template <typename T, int SHIFT, bool IS_420, bool IS_SEMI> struct rs_format_planar {
+    static constexpr int group_width = 2;
+    static constexpr bool is_420     = IS_420;
+    static constexpr int bit_depth   = sizeof(T) == 1 ? 8 : 10;
+    static constexpr int cshift      = IS_420 ? 1 : 0;
+
+    static inline ushort read_lm(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return ((const T *)src)[mad24(y, w, x)] >> SHIFT;
+    }
+    static inline ushort read_cb(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        if constexpr (IS_SEMI)
+            return ((const T *)src)[mad24(y, w, x * 2 + w * h)] >> SHIFT;
+        else
+            return ((const T *)src)[mad24(y, w / 2, x + w * h)] >> SHIFT;
+    }
+    static inline ushort read_cr(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        if constexpr (IS_SEMI)
+            return ((const T *)src)[mad24(y, w, x * 2 + w * h + 1)] >> SHIFT;
+        else
+            return ((const T *)src)[mad24(y, w / 2, x + w * h + w / 2 * (h >> cshift))] >> SHIFT;
+    }
+    static inline T round(float v) { return (T)((T)(v + (float)0.5) << SHIFT); }
+
+    static inline void write(unsigned char *dst_c, uint32_t pitch, uint32_t height, uint32_t sx, uint32_t sy,
+                             uint32_t offset_x, uint32_t offset_y, const float *lm, const float *cb, const float *cr,
+                             bool chroma) {
+        T *dst          = (T *)dst_c;
+        uint32_t offset = mad24(sy + offset_y, pitch, sx + offset_x);
+        dst[offset]     = round(lm[0]);
+        dst[offset + 1] = round(lm[1]);
+        if (!chroma)
+            return;
+        if constexpr (IS_SEMI) {
+            uint32_t uv_offset = pitch * height + mad24((sy >> cshift) + (offset_y >> cshift), pitch, sx + offset_x);
+            dst[uv_offset]     = round(cb[0]);
+            dst[uv_offset + 1] = round(cr[0]);
+        } else {
+            uint32_t uv_offset = mad24((sy >> cshift) + (offset_y >> cshift), pitch / 2, sx / 2 + offset_x / 2);
+            dst[pitch * height + uv_offset]                                = round(cb[0]);
+            dst[pitch * height + pitch / 2 * (height >> cshift) + uv_offset] = round(cr[0]);
+        }
+    }
+};
+
+template <> struct rs_format<IMPL_VIDEO_I420> : rs_format_planar<unsigned char, 0, true, false> {};
+template <> struct rs_format<IMPL_VIDEO_NV12> : rs_format_planar<unsigned char, 0, true, true> {};
+template <> struct rs_format<IMPL_VIDEO_YUV420P10LE> : rs_format_planar<unsigned short, 0, true, false> {};
+template <> struct rs_format<IMPL_VIDEO_P010> : rs_format_planar<unsigned short, 6, true, true> {};
+template <> struct rs_format<IMPL_VIDEO_YUV422P10LE> : rs_format_planar<unsigned short, 0, false, false> {};
+
+template <> struct rs_format<IMPL_VIDEO_Y210> {
+    static constexpr int group_width = 2;
+    static constexpr bool is_420     = false;
+    static constexpr int bit_depth   = 10;
+
+    static inline ushort read_lm(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return ((const unsigned short *)src)[mad24(y, w * 2, mad24(x / 2, (uint32_t)4, (x % 2) * 2))] >> 6;
+    }
+    static inline ushort read_cb(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return ((const unsigned short *)src)[mad24(y, w * 2, mad24(x, (uint32_t)4, (uint32_t)1))] >> 6;
+    }
+    static inline ushort read_cr(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return ((const unsigned short *)src)[mad24(y, w * 2, mad24(x, (uint32_t)4, (uint32_t)3))] >> 6;
+    }
+    static inline void write(unsigned char *dst_c, uint32_t pitch, uint32_t height, uint32_t sx, uint32_t sy,
+                             uint32_t offset_x, uint32_t offset_y, const float *lm, const float *cb, const float *cr,
+                             bool chroma) {
+        (void)height;
+        (void)chroma;
+        unsigned short *dst = (unsigned short *)dst_c;
+        uint32_t offset     = mad24(sy + offset_y, pitch * 2, (sx + offset_x) * 2);
+        dst[offset]         = ((unsigned short)lm[0] << 6) & 0xffc0;
+        dst[offset + 1]     = ((unsigned short)cb[0] << 6) & 0xffc0;
+        dst[offset + 2]     = ((unsigned short)lm[1] << 6) & 0xffc0;
+        dst[offset + 3]     = ((unsigned short)cr[0] << 6) & 0xffc0;
+    }
+};
+
+template <> struct rs_format<IMPL_VIDEO_YUV422YCBCR10BE> {
+    static constexpr int group_width = 2;
+    static constexpr bool is_420     = false;
+    static constexpr int bit_depth   = 10;
+
+    static inline ushort read_lm(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_yuv422ycbcr10be_lm(x, y, (unsigned char *)src, w * 5 / 2);
+    }
+    static inline ushort read_cb(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_yuv422ycbcr10be_cb(x, y, (unsigned char *)src, w * 5 / 2);
+    }
+    static inline ushort read_cr(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_yuv422ycbcr10be_cr(x, y, (unsigned char *)src, w * 5 / 2);
+    }
+    static inline void write(unsigned char *dst, uint32_t pitch, uint32_t height, uint32_t sx, uint32_t sy,
+                             uint32_t offset_x, uint32_t offset_y, const float *lm, const float *cb, const float *cr,
+                             bool chroma) {
+        (void)height;
+        (void)chroma;
+        unsigned long c0 = (unsigned long)(cb[0] + (float)0.5);
+        unsigned long y0 = (unsigned long)(lm[0] + (float)0.5);
+        unsigned long c1 = (unsigned long)(cr[0] + (float)0.5);
+        unsigned long y1 = (unsigned long)(lm[1] + (float)0.5);
+
+        uint32_t offset = mad24(sy + offset_y, pitch * 5 / 2, (sx + offset_x) / 2 * 5);
+        dst[offset]     = (unsigned char)((c0 >> 2) & 0xff);
+        dst[offset + 1] = (unsigned char)(((c0 & 0x3) << 6) | ((y0 >> 4) & 0x3f));
+        dst[offset + 2] = (unsigned char)(((y0 & 0xf) << 4) | ((c1 >> 6) & 0xf));
+        dst[offset + 3] = (unsigned char)(((c1 & 0x3f) << 2) | ((y1 >> 8) & 0x3));
+        dst[offset + 4] = (unsigned char)(y1 & 0xff);
+    }
+};
+
+template <> struct rs_format<IMPL_VIDEO_V210> {
+    static constexpr int group_width = 6;
+    static constexpr bool is_420     = false;
+    static constexpr int bit_depth   = 10;
+
+    static inline ushort read_lm(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_v210_lm((unsigned int *)src, y, x, w * 4 / 6);
+    }
+    static inline ushort read_cb(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_v210_cb((unsigned int *)src, y, x, w * 4 / 6);
+    }
+    static inline ushort read_cr(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        return read_v210_cr((unsigned int *)src, y, x, w * 4 / 6);
+    }
+    static inline void write(unsigned char *dst_c, uint32_t pitch, uint32_t height, uint32_t sx, uint32_t sy,
+                             uint32_t offset_x, uint32_t offset_y, const float *lm, const float *cb, const float *cr,
+                             bool chroma) {
+        (void)height;
+        (void)chroma;
+        unsigned int *dst = (unsigned int *)dst_c;
+        uint32_t offset   = mad24(sy + offset_y, pitch * 4 / 6, (sx + offset_x) * 4 / 6);
+        dst[offset]       = ((unsigned int)cb[0] & 0x3ff) | (((unsigned int)lm[0] & 0x3ff) << 10) |
+                      (((unsigned int)cr[0] & 0x3ff) << 20);
+        dst[offset + 1] = ((unsigned int)lm[1] & 0x3ff) | (((unsigned int)cb[1] & 0x3ff) << 10) |
+                          (((unsigned int)lm[2] & 0x3ff) << 20);
+        dst[offset + 2] = ((unsigned int)cr[1] & 0x3ff) | (((unsigned int)lm[3] & 0x3ff) << 10) |
+                          (((unsigned int)cb[2] & 0x3ff) << 20);
+        dst[offset + 3] = ((unsigned int)lm[4] & 0x3ff) | (((unsigned int)cr[2] & 0x3ff) << 10) |
+                          (((unsigned int)lm[5] & 0x3ff) << 20);
+    }
+};
+
+template <> struct rs_format<IMPL_VIDEO_YUV422YCBCR10LE> {
+    static constexpr int group_width = 2;
+    static constexpr bool is_420     = false;
+    static constexpr int bit_depth   = 10;
+
+    static inline ushort read_lm(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        csc_pair p;
+        csc_pack_ycbcr10le::unpack(src, w, x / 2, y, p);
+        return (x & 1) ? p.y1 : p.y0;
+    }
+    static inline ushort read_cb(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        csc_pair p;
+        csc_pack_ycbcr10le::unpack(src, w, x, y, p);
+        return p.cb;
+    }
+    static inline ushort read_cr(const unsigned char *src, uint32_t w, uint32_t h, uint32_t y, uint32_t x) {
+        (void)h;
+        csc_pair p;
+        csc_pack_ycbcr10le::unpack(src, w, x, y, p);
+        return p.cr;
+    }
+    static inline void write(unsigned char *dst, uint32_t pitch, uint32_t height, uint32_t sx, uint32_t sy,
+                             uint32_t offset_x, uint32_t offset_y, const float *lm, const float *cb, const float *cr,
+                             bool chroma) {
+        (void)height;
+        (void)chroma;
+        csc_pair p;
+        p.cb = (unsigned short)(cb[0] + (float)0.5) & 0x3ff;
+        p.y0 = (unsigned short)(lm[0] + (float)0.5) & 0x3ff;
+        p.cr = (unsigned short)(cr[0] + (float)0.5) & 0x3ff;
+        p.y1 = (unsigned short)(lm[1] + (float)0.5) & 0x3ff;
+        csc_pack_ycbcr10le::pack(dst, pitch, (sx + offset_x) / 2, sy + offset_y, p);
+    }
+};
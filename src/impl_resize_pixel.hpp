@@ -4,682 +4,882 @@
 #pragma once
 
 #include "impl_resize.hpp"
+#include "impl_resize_format.hpp"
+#include "impl_sg.hpp"
 #include "impl_trace.hpp"
 
+/**
+ * Interior work items of a resize, whose luma and chroma taps never reach the source
+ * edges. A work item covers item_w x item_h luma pixels and the chroma sharing them,
+ * chroma is subsampled horizontally and, when is_420, vertically.
+ */
+inline struct rs_region rs_interior_items(const struct rs_interior &interior, uint32_t item_w, uint32_t item_h,
+                                          bool is_420) {
+    const uint32_t cdiv = is_420 ? 2 : 1;
+    // in luma pixels, then whole work items inside
+    const uint32_t x0 = sycl::max(interior.luma.x0, interior.chroma.x0 * 2);
+    const uint32_t x1 = sycl::min(interior.luma.x1, interior.chroma.x1 * 2);
+    const uint32_t y0 = sycl::max(interior.luma.y0, interior.chroma.y0 * cdiv);
+    const uint32_t y1 = sycl::min(interior.luma.y1, interior.chroma.y1 * cdiv);
+    struct rs_region in = {(x0 + item_w - 1) / item_w, (y0 + item_h - 1) / item_h, x1 / item_w, y1 / item_h};
+    if (in.x1 <= in.x0 || in.y1 <= in.y0)
+        in = {0, 0, 0, 0};
+    return in;
+}
+
+/* item of the border around in, counted by rows above, sides beside and rows below it */
+inline void rs_border_item(uint32_t i, uint32_t items_w, const struct rs_region &in, uint32_t &gx, uint32_t &gy) {
+    const uint32_t top = in.y0 * items_w;
+    if (i < top) {
+        gy = i / items_w;
+        gx = i % items_w;
+        return;
+    }
+    i -= top;
+    const uint32_t side = in.x0 + items_w - in.x1;
+    if (i < (in.y1 - in.y0) * side) {
+        const uint32_t c = i % side;
+        gy               = in.y0 + i / side;
+        gx               = c < in.x0 ? c : in.x1 + c - in.x0;
+        return;
+    }
+    i -= (in.y1 - in.y0) * side;
+    gy = in.y1 + i / items_w;
+    gx = i % items_w;
+}
+
+/**
+ * Run a resize as two kernels, an unclamped one over the interior work items and a
+ * clamped one over the border around them. A work item covers item_w x item_h pixels,
+ * pixel(gy, gx, clamp) resizes item (gy, gx) of the image, clamp is std::true_type when
+ * its taps may cross the source edges. With aspect_fit the border kernel also writes the
+ * fill colour to the items of the bars around the image, so every destination pixel is
+ * written once. The border kernel runs after the interior kernel, so prs->evt covers
+ * both.
+ */
+template <impl_video_format FORMAT, impl_interp_mtd INTERP_METHOD, class Func>
+IMPL_STATUS rs_submit_split(struct impl_resize_params *prs, const impl_resize_context *prst, void *dep_evt,
+                            unsigned char *dst_ptr, uint32_t item_w, uint32_t item_h, const Func &pixel) {
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int group_width = fmt::group_width;
+    queue q                   = *(queue *)(prs->pq);
+    IMPL_STATUS ret           = IMPL_STATUS_SUCCESS;
+    const struct rs_rect fit  = rs_fit_rect(prs);
+    const uint32_t items_w    = fit.w / item_w;
+    const uint32_t items_h    = fit.h / item_h;
+    const uint32_t ix         = fit.x / item_w;
+    const uint32_t iy         = fit.y / item_h;
+    const uint32_t canvas_w   = prs->dst_width / item_w;
+    const uint32_t canvas_h   = prs->dst_height / item_h;
+    const struct rs_region in = rs_interior_items(prst->interior, item_w, item_h, fmt::is_420);
+    // interior in canvas items, the image is at (ix, iy) of the canvas
+    const struct rs_region cin = {in.x0 + ix, in.y0 + iy, in.x1 + ix, in.y1 + iy};
+    const uint32_t in_w        = in.x1 - in.x0;
+    const uint32_t in_h        = in.y1 - in.y0;
+    const uint32_t borders     = canvas_h * canvas_w - in_h * in_w;
+
+    const uint32_t pitch    = prs->pitch_pixel;
+    const uint32_t height   = prs->surface_height;
+    const uint32_t offset_x = prs->offset_x;
+    const uint32_t offset_y = prs->offset_y;
+    const float fill[3]     = {(float)prs->fill_y, (float)prs->fill_cb, (float)prs->fill_cr};
+    auto bar                = [=](uint32_t gy, uint32_t gx) {
+        float lm[group_width], cb[group_width / 2], cr[group_width / 2];
+        for (int i = 0; i < group_width; i++)
+            lm[i] = fill[0];
+        for (int i = 0; i < group_width / 2; i++) {
+            cb[i] = fill[1];
+            cr[i] = fill[2];
+        }
+        for (uint32_t r = 0; r < item_h; r++) {
+            for (uint32_t g = 0; g < item_w; g += group_width) {
+                const uint32_t sx = gx * item_w + g;
+                const uint32_t sy = gy * item_h + r;
+                fmt::write(dst_ptr, pitch, height, sx, sy, offset_x, offset_y, lm, cb, cr, !fmt::is_420 || sy % 2 == 0);
+            }
+        }
+    };
+
+    sycl::event event, inner;
+    void *dep = dep_evt;
+    if (in_w * in_h > 0) {
+        event = q.submit([&](sycl::handler &h) {
+            try {
+                if (dep != NULL) {
+                    auto d_evt = *(sycl::event *)dep;
+                    h.depends_on(d_evt);
+                }
+                h.parallel_for(sycl::range(in_h, in_w), [=](sycl::item<2> item) {
+                    pixel((uint32_t)item[0] + in.y0, (uint32_t)item[1] + in.x0, std::false_type());
+                });
+            } catch (std::exception e) {
+                err("%s, SYCL exception caught: %s\n", __func__, e.what());
+                ret = IMPL_STATUS_FAIL;
+            }
+        });
+        // an in-order queue runs the border kernel after this one anyway, and has no event with discard_events
+        inner = event;
+        dep   = q.is_in_order() ? NULL : &inner;
+    }
+    if (borders > 0) {
+        event = q.submit([&](sycl::handler &h) {
+            try {
+                if (dep != NULL) {
+                    auto d_evt = *(sycl::event *)dep;
+                    h.depends_on(d_evt);
+                }
+                h.parallel_for(sycl::range(borders), [=](sycl::item<1> item) {
+                    uint32_t gx, gy;
+                    rs_border_item(item[0], canvas_w, cin, gx, gy);
+                    if (gx - ix < items_w && gy - iy < items_h)
+                        pixel(gy - iy, gx - ix, std::true_type());
+                    else
+                        bar(gy, gx);
+                });
+            } catch (std::exception e) {
+                err("%s, SYCL exception caught: %s\n", __func__, e.what());
+                ret = IMPL_STATUS_FAIL;
+            }
+        });
+    }
+
+    impl_common_run_done(q, prs->evt, event, prs->is_async);
+    return ret;
+}
+
 template <impl_interp_mtd INTERP_METHOD>
 IMPL_STATUS impl_resize_i420(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr,
                              unsigned char *dst_ptr, void *dep_evt) {
-    (void)prst;
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
     IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
-
-    queue q         = *(queue *)(prs->pq);
-    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
-    auto event      = q.submit([&](sycl::handler &h) {
-        const uint32_t pitch    = prs->pitch_pixel;
-        const uint32_t height   = prs->surface_height;
-        const uint32_t offset_x = prs->offset_x;
-        const uint32_t offset_y = prs->offset_y;
-
-        uint32_t src_u_offset = src_width * src_height;
-        uint32_t dst_u_offset = pitch * height;
-        uint32_t src_v_offset = src_u_offset * 5 / 4;
-        uint32_t dst_v_offset = dst_u_offset * 5 / 4;
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
+
+    const uint32_t pitch    = prs->pitch_pixel;
+    const uint32_t height   = prs->surface_height;
+    const uint32_t offset_x = rs_offset_x(prs);
+    const uint32_t offset_y = rs_offset_y(prs);
+
+    uint32_t src_u_offset = src_width * src_height;
+    uint32_t dst_u_offset = pitch * height;
+    uint32_t src_v_offset = src_u_offset * 5 / 4;
+    uint32_t dst_v_offset = dst_u_offset * 5 / 4;
+
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
+
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        uint32_t sx            = 2 * gx;
+        uint32_t sy            = 2 * gy;
+
+        auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
+            return src_ptr[mad24(y, src_width, x)];
+        };
+        uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
+
+        float yw[datasize];
+        uint32_t yid[datasize];
+
+        // Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i] = (unsigned char)(value + (float)0.5);
+        }
 
-        try {
-            if (dep_evt != NULL) {
-                auto d_evt = *(sycl::event *)dep_evt;
-                h.depends_on(d_evt);
-            }
-            h.parallel_for(sycl::range(dst_height / 2, dst_width / 2), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-                uint32_t sx            = 2 * item[1];
-                uint32_t sy            = 2 * item[0];
+        // next line Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy + 1, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i + pitch] = (unsigned char)(value + (float)0.5);
+        }
 
-                auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
-                    return src_ptr[mad24(y, src_width, x)];
-                };
-                uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
+        // UV
+        {
+            auto readcr = [&src_ptr, &src_width, &src_u_offset](uint32_t y, uint32_t x) {
+                return src_ptr[mad24(y, src_width / 2, x + src_u_offset)];
+            };
+            auto readcb = [&src_ptr, &src_width, &src_v_offset](uint32_t y, uint32_t x) {
+                return src_ptr[mad24(y, src_width / 2, x + src_v_offset)];
+            };
 
-                float yw[datasize];
-                uint32_t yid[datasize];
+            uint32_t uv_offset = mad24(sy / 2 + offset_y / 2, pitch / 2, sx / 2 + offset_x / 2);
 
-                // Y0 Y1
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
-#pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i] = (unsigned char)(value + (float)0.5);
-                }
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float valuecr, valuecb;
+            get_idw<INTERP_METHOD, CLAMP>(sy / 2, coef_height, src_height / 2, yid, yw, origin_y / 2);
+            get_idw<INTERP_METHOD, CLAMP>(sx / 2, coef_width, src_width / 2, xid, xw, origin_x / 2);
 
-                // next line Y0 Y1
-                get_idw<INTERP_METHOD>(sy + 1, coef_height, src_height, yid, yw);
-#pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i + pitch] = (unsigned char)(value + (float)0.5);
-                }
+            valuecr = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+            dst_ptr[dst_u_offset + uv_offset] = (unsigned char)(valuecr + (float)0.5);
 
-                // UV
-                {
-                    auto readcr = [&src_ptr, &src_width, &src_u_offset](uint32_t y, uint32_t x) {
-                        return src_ptr[mad24(y, src_width / 2, x + src_u_offset)];
-                    };
-                    auto readcb = [&src_ptr, &src_width, &src_v_offset](uint32_t y, uint32_t x) {
-                        return src_ptr[mad24(y, src_width / 2, x + src_v_offset)];
-                    };
-
-                    uint32_t uv_offset = mad24(sy / 2 + offset_y / 2, pitch / 2, sx / 2 + offset_x / 2);
-
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float valuecr, valuecb;
-                    get_idw<INTERP_METHOD>(sy / 2, coef_height, src_height / 2, yid, yw);
-                    get_idw<INTERP_METHOD>(sx / 2, coef_width, src_width / 2, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecr = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecr = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-                    dst_ptr[dst_u_offset + uv_offset] = (unsigned char)(valuecr + (float)0.5);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecb = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecb = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
-                    dst_ptr[dst_v_offset + uv_offset] = (unsigned char)(valuecb + (float)0.5);
-                }
-            });
-        } catch (std::exception e) {
-            err("%s, SYCL exception caught: %s\n", __func__, e.what());
-            ret = IMPL_STATUS_FAIL;
+            valuecb = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+            dst_ptr[dst_v_offset + uv_offset] = (unsigned char)(valuecb + (float)0.5);
         }
-    });
+    };
 
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
-    return ret;
+    return rs_submit_split<IMPL_VIDEO_I420, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr, 2, 2, pixel);
 }
 
 template <impl_interp_mtd INTERP_METHOD>
 IMPL_STATUS impl_resize_yuv420p10le(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr_c,
                                     unsigned char *dst_ptr_c, void *dep_evt) {
-    (void)prst;
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
     IMPL_ASSERT(src_ptr_c != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr_c != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
 
-    queue q         = *(queue *)(prs->pq);
-    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
-    auto event      = q.submit([&](sycl::handler &h) {
-        const uint32_t pitch    = prs->pitch_pixel;
-        const uint32_t height   = prs->surface_height;
-        const uint32_t offset_x = prs->offset_x;
-        const uint32_t offset_y = prs->offset_y;
+    const uint32_t pitch    = prs->pitch_pixel;
+    const uint32_t height   = prs->surface_height;
+    const uint32_t offset_x = rs_offset_x(prs);
+    const uint32_t offset_y = rs_offset_y(prs);
 
-        uint32_t src_u_offset = src_width * src_height;
-        uint32_t dst_u_offset = pitch * height;
-        uint32_t src_v_offset = src_u_offset * 5 / 4;
-        uint32_t dst_v_offset = dst_u_offset * 5 / 4;
+    uint32_t src_u_offset = src_width * src_height;
+    uint32_t dst_u_offset = pitch * height;
+    uint32_t src_v_offset = src_u_offset * 5 / 4;
+    uint32_t dst_v_offset = dst_u_offset * 5 / 4;
 
-        unsigned short *src_ptr = (unsigned short *)src_ptr_c;
-        unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
+    unsigned short *src_ptr = (unsigned short *)src_ptr_c;
+    unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
 
-        try {
-            if (dep_evt != NULL) {
-                auto d_evt = *(sycl::event *)dep_evt;
-                h.depends_on(d_evt);
-            }
-            h.parallel_for(sycl::range(dst_height / 2, dst_width / 2), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-                uint32_t sx            = 2 * item[1];
-                uint32_t sy            = 2 * item[0];
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
 
-                auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
-                    return src_ptr[mad24(y, src_width, x)];
-                };
-                uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        uint32_t sx            = 2 * gx;
+        uint32_t sy            = 2 * gy;
 
-                float yw[datasize];
-                uint32_t yid[datasize];
+        auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
+            return src_ptr[mad24(y, src_width, x)];
+        };
+        uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
 
-                // Y0 Y1
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
+        float yw[datasize];
+        uint32_t yid[datasize];
+
+        // Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
 #pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i] = (unsigned short)(value + (float)0.5);
-                }
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i] = (unsigned short)(value + (float)0.5);
+        }
 
-                // next line Y0 Y1
-                get_idw<INTERP_METHOD>(sy + 1, coef_height, src_height, yid, yw);
+        // next line Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy + 1, coef_height, src_height, yid, yw, origin_y);
 #pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i + pitch] = (unsigned short)(value + (float)0.5);
-                }
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i + pitch] = (unsigned short)(value + (float)0.5);
+        }
 
-                // UV
-                {
-                    auto readcr = [&src_ptr, &src_width, &src_u_offset](uint32_t y, uint32_t x) {
-                        return src_ptr[mad24(y, src_width / 2, x + src_u_offset)];
-                    };
-                    auto readcb = [&src_ptr, &src_width, &src_v_offset](uint32_t y, uint32_t x) {
-                        return src_ptr[mad24(y, src_width / 2, x + src_v_offset)];
-                    };
-
-                    uint32_t uv_offset = mad24(sy / 2 + offset_y / 2, pitch / 2, sx / 2 + offset_x / 2);
-
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float valuecr, valuecb;
-                    get_idw<INTERP_METHOD>(sy / 2, coef_height, src_height / 2, yid, yw);
-                    get_idw<INTERP_METHOD>(sx / 2, coef_width, src_width / 2, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecr = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecr = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-                    dst_ptr[dst_u_offset + uv_offset] = (unsigned short)(valuecr + (float)0.5);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecb = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecb = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
-                    dst_ptr[dst_v_offset + uv_offset] = (unsigned short)(valuecb + (float)0.5);
-                }
-            });
-        } catch (std::exception e) {
-            err("%s, SYCL exception caught: %s\n", __func__, e.what());
-            ret = IMPL_STATUS_FAIL;
+        // UV
+        {
+            auto readcr = [&src_ptr, &src_width, &src_u_offset](uint32_t y, uint32_t x) {
+                return src_ptr[mad24(y, src_width / 2, x + src_u_offset)];
+            };
+            auto readcb = [&src_ptr, &src_width, &src_v_offset](uint32_t y, uint32_t x) {
+                return src_ptr[mad24(y, src_width / 2, x + src_v_offset)];
+            };
+
+            uint32_t uv_offset = mad24(sy / 2 + offset_y / 2, pitch / 2, sx / 2 + offset_x / 2);
+
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float valuecr, valuecb;
+            get_idw<INTERP_METHOD, CLAMP>(sy / 2, coef_height, src_height / 2, yid, yw, origin_y / 2);
+            get_idw<INTERP_METHOD, CLAMP>(sx / 2, coef_width, src_width / 2, xid, xw, origin_x / 2);
+
+            valuecr = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+            dst_ptr[dst_u_offset + uv_offset] = (unsigned short)(valuecr + (float)0.5);
+
+            valuecb = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+            dst_ptr[dst_v_offset + uv_offset] = (unsigned short)(valuecb + (float)0.5);
         }
-    });
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
-    return ret;
+    };
+
+    return rs_submit_split<IMPL_VIDEO_YUV420P10LE, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr_c, 2, 2, pixel);
 }
 
 template <impl_interp_mtd INTERP_METHOD>
 IMPL_STATUS impl_resize_p010(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr_c,
                              unsigned char *dst_ptr_c, void *dep_evt) {
-    (void)prst;
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
     IMPL_ASSERT(src_ptr_c != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr_c != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
 
-    queue q         = *(queue *)(prs->pq);
-    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
-    auto event      = q.submit([&](sycl::handler &h) {
-        const uint32_t pitch    = prs->pitch_pixel;
-        const uint32_t height   = prs->surface_height;
-        const uint32_t offset_x = prs->offset_x;
-        const uint32_t offset_y = prs->offset_y;
+    const uint32_t pitch    = prs->pitch_pixel;
+    const uint32_t height   = prs->surface_height;
+    const uint32_t offset_x = rs_offset_x(prs);
+    const uint32_t offset_y = rs_offset_y(prs);
 
-        uint32_t src_offset = src_width * src_height;
-        uint32_t dst_offset = pitch * height;
+    uint32_t src_offset = src_width * src_height;
+    uint32_t dst_offset = pitch * height;
 
-        unsigned short *src_ptr = (unsigned short *)src_ptr_c;
-        unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
+    unsigned short *src_ptr = (unsigned short *)src_ptr_c;
+    unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
 
-        try {
-            if (dep_evt != NULL) {
-                auto d_evt = *(sycl::event *)dep_evt;
-                h.depends_on(d_evt);
-            }
-            h.parallel_for(sycl::range(dst_height / 2, dst_width / 2), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-                uint32_t sx            = 2 * item[1];
-                uint32_t sy            = 2 * item[0];
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
 
-                auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
-                    return (src_ptr[mad24(y, src_width, x)] >> 6);
-                };
-                uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        uint32_t sx            = 2 * gx;
+        uint32_t sy            = 2 * gy;
 
-                float yw[datasize];
-                uint32_t yid[datasize];
+        auto readlm = [&src_ptr, &src_width](uint32_t y, uint32_t x) {
+            return (src_ptr[mad24(y, src_width, x)] >> 6);
+        };
+        uint32_t offset = mad24(sy + offset_y, pitch, +sx + offset_x);
+
+        float yw[datasize];
+        uint32_t yid[datasize];
 
-                // Y0 Y1
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
+        // Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
 #pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i] = ((unsigned short)(value + (float)0.5) << 6);
-                }
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i] = ((unsigned short)(value + (float)0.5) << 6);
+        }
 
-                // next line Y0 Y1
-                get_idw<INTERP_METHOD>(sy + 1, coef_height, src_height, yid, yw);
+        // next line Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy + 1, coef_height, src_height, yid, yw, origin_y);
 #pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float value;
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        value = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        value = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    dst_ptr[offset + i + pitch] = ((unsigned short)(value + (float)0.5) << 6);
-                }
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float value;
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            value = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+            dst_ptr[offset + i + pitch] = ((unsigned short)(value + (float)0.5) << 6);
+        }
 
-                // UV
-                {
-                    auto readcr = [&src_ptr, &src_width, &src_offset](uint32_t y, uint32_t x) {
-                        return (src_ptr[mad24(y, src_width, x * 2 + src_offset)] >> 6);
-                    };
-                    auto readcb = [&src_ptr, &src_width, &src_offset](uint32_t y, uint32_t x) {
-                        return (src_ptr[mad24(y, src_width, x * 2 + src_offset + 1)] >> 6);
-                    };
-
-                    uint32_t uv_offset = dst_offset + mad24(sy / 2 + offset_y / 2, pitch, sx + offset_x);
-
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    float valuecr, valuecb;
-                    get_idw<INTERP_METHOD>(sy / 2, coef_height, src_height / 2, yid, yw);
-                    get_idw<INTERP_METHOD>(sx / 2, coef_width, src_width / 2, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecr = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecr = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-                    dst_ptr[uv_offset] = ((unsigned short)(valuecr + (float)0.5) << 6);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        valuecb = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        valuecb = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
-                    dst_ptr[uv_offset + 1] = ((unsigned short)(valuecb + (float)0.5) << 6);
-                }
-            });
-        } catch (std::exception e) {
-            err("%s, SYCL exception caught: %s\n", __func__, e.what());
-            ret = IMPL_STATUS_FAIL;
+        // UV
+        {
+            auto readcr = [&src_ptr, &src_width, &src_offset](uint32_t y, uint32_t x) {
+                return (src_ptr[mad24(y, src_width, x * 2 + src_offset)] >> 6);
+            };
+            auto readcb = [&src_ptr, &src_width, &src_offset](uint32_t y, uint32_t x) {
+                return (src_ptr[mad24(y, src_width, x * 2 + src_offset + 1)] >> 6);
+            };
+
+            uint32_t uv_offset = dst_offset + mad24(sy / 2 + offset_y / 2, pitch, sx + offset_x);
+
+            float xw[datasize];
+            uint32_t xid[datasize];
+            float valuecr, valuecb;
+            get_idw<INTERP_METHOD, CLAMP>(sy / 2, coef_height, src_height / 2, yid, yw, origin_y / 2);
+            get_idw<INTERP_METHOD, CLAMP>(sx / 2, coef_width, src_width / 2, xid, xw, origin_x / 2);
+
+            valuecr = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+            dst_ptr[uv_offset] = ((unsigned short)(valuecr + (float)0.5) << 6);
+
+            valuecb = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+            dst_ptr[uv_offset + 1] = ((unsigned short)(valuecb + (float)0.5) << 6);
         }
-    });
+    };
 
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
-    return ret;
+    return rs_submit_split<IMPL_VIDEO_P010, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr_c, 2, 2, pixel);
 }
 
-template <impl_interp_mtd INTERP_METHOD>
-IMPL_STATUS impl_resize_yuv422ycbcr10be(struct impl_resize_params *prs, impl_resize_context *prst,
-                                        unsigned char *src_ptr, unsigned char *dst_ptr, void *dep_evt) {
-    (void)prst;
+/* contiguous yuv422ycbcr10be resize source */
+struct rs_ycbcr10be_frame {
+    unsigned char *src_ptr;
+    uint32_t pitch_src;
+    inline ushort lm(uint32_t y, uint32_t x) const { return read_yuv422ycbcr10be_lm(x, y, src_ptr, pitch_src); }
+    inline ushort cb(uint32_t y, uint32_t x) const { return read_yuv422ycbcr10be_cb(x, y, src_ptr, pitch_src); }
+    inline ushort cr(uint32_t y, uint32_t x) const { return read_yuv422ycbcr10be_cr(x, y, src_ptr, pitch_src); }
+};
+
+/* scatter-gather yuv422ycbcr10be resize source */
+struct rs_ycbcr10be_sg {
+    struct sg_kernel_src sg;
+    inline ushort lm(uint32_t y, uint32_t x) const { return sg_read_lm(sg, x, y); }
+    inline ushort cb(uint32_t y, uint32_t x) const { return sg_read_cb(sg, x, y); }
+    inline ushort cr(uint32_t y, uint32_t x) const { return sg_read_cr(sg, x, y); }
+};
+
+template <impl_interp_mtd INTERP_METHOD, typename SRC>
+IMPL_STATUS impl_resize_yuv422ycbcr10be_src(struct impl_resize_params *prs, const impl_resize_context *prst,
+                                            const SRC &source, unsigned char *dst_ptr, void *dep_evt) {
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
-    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
 
-    queue q         = *(queue *)(prs->pq);
-    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
-    auto event      = q.submit([&](sycl::handler &h) {
-        const uint32_t pitch    = prs->pitch_pixel * 5 / 2;
-        const uint32_t offset_x = prs->offset_x;
-        const uint32_t offset_y = prs->offset_y;
+    const uint32_t pitch    = prs->pitch_pixel * 5 / 2;
+    const uint32_t offset_x = rs_offset_x(prs);
+    const uint32_t offset_y = rs_offset_y(prs);
 
-        uint32_t pitch_src = src_width * 5 / 2;
-        try {
-            if (dep_evt != NULL) {
-                auto d_evt = *(sycl::event *)dep_evt;
-                h.depends_on(d_evt);
-            }
-            h.parallel_for(sycl::range(dst_height, dst_width / 2), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-                uint32_t sx            = 2 * item[1];
-                uint32_t sy            = item[0];
+    SRC src = source;
 
-                float dst_lm[2];
-                float dst_cb;
-                float dst_cr;
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
 
-                auto readlm = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                    return read_yuv422ycbcr10be_lm(x, y, src_ptr, pitch_src);
-                };
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        uint32_t sx            = 2 * gx;
+        uint32_t sy            = gy;
 
-                float yw[datasize];
-                uint32_t yid[datasize];
+        float dst_lm[2];
+        float dst_cb;
+        float dst_cr;
+
+        auto readlm = [&src](uint32_t y, uint32_t x) { return src.lm(y, x); };
+
+        float yw[datasize];
+        uint32_t yid[datasize];
 
-                // Y0 Y1
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
+        // Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
 #pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_lm[i] = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_lm[i] = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                }
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
 
-                // UV
-                {
-                    auto readcr = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                        return read_yuv422ycbcr10be_cr(x, y, src_ptr, pitch_src);
-                    };
-                    auto readcb = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                        return read_yuv422ycbcr10be_cb(x, y, src_ptr, pitch_src);
-                    };
-
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    get_idw<INTERP_METHOD>(sx / 2, coef_width, src_width / 2, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_cb = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_cb = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_cr = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_cr = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-                }
+            dst_lm[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+        }
 
-                unsigned long cb = (unsigned long)(dst_cb + (float)0.5);
-                unsigned long y0 = (unsigned long)(dst_lm[0] + (float)0.5);
-                unsigned long cr = (unsigned long)(dst_cr + (float)0.5);
-                unsigned long y1 = (unsigned long)(dst_lm[1] + (float)0.5);
-
-                unsigned long out0 = ((cb >> 2) & 0xff);
-                unsigned long out1 = ((cb & 0x3) << 6) | ((y0 >> 4) & 0x3f);
-                unsigned long out2 = ((y0 & 0xf) << 4) | ((cr >> 6) & 0xf);
-                unsigned long out3 = ((cr & 0x3f) << 2) | ((y1 >> 8) & 0x3);
-                unsigned long out4 = (y1 & 0xff);
-
-                uint32_t offset     = mad24(sy + offset_y, pitch, (sx + offset_x) / 2 * 5);
-                dst_ptr[offset]     = (unsigned char)out0;
-                dst_ptr[offset + 1] = (unsigned char)out1;
-                dst_ptr[offset + 2] = (unsigned char)out2;
-                dst_ptr[offset + 3] = (unsigned char)out3;
-                dst_ptr[offset + 4] = (unsigned char)out4;
-            });
-        } catch (std::exception e) {
-            err("%s, SYCL exception caught: %s\n", __func__, e.what());
-            ret = IMPL_STATUS_FAIL;
+        // UV
+        {
+            auto readcr = [&src](uint32_t y, uint32_t x) { return src.cr(y, x); };
+            auto readcb = [&src](uint32_t y, uint32_t x) { return src.cb(y, x); };
+
+            float xw[datasize];
+            uint32_t xid[datasize];
+            get_idw<INTERP_METHOD, CLAMP>(sx / 2, coef_width, src_width / 2, xid, xw, origin_x / 2);
+
+            dst_cb = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+
+            dst_cr = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
         }
-    });
 
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
-    return ret;
+        unsigned long cb = (unsigned long)(dst_cb + (float)0.5);
+        unsigned long y0 = (unsigned long)(dst_lm[0] + (float)0.5);
+        unsigned long cr = (unsigned long)(dst_cr + (float)0.5);
+        unsigned long y1 = (unsigned long)(dst_lm[1] + (float)0.5);
+
+        unsigned long out0 = ((cb >> 2) & 0xff);
+        unsigned long out1 = ((cb & 0x3) << 6) | ((y0 >> 4) & 0x3f);
+        unsigned long out2 = ((y0 & 0xf) << 4) | ((cr >> 6) & 0xf);
+        unsigned long out3 = ((cr & 0x3f) << 2) | ((y1 >> 8) & 0x3);
+        unsigned long out4 = (y1 & 0xff);
+
+        uint32_t offset     = mad24(sy + offset_y, pitch, (sx + offset_x) / 2 * 5);
+        dst_ptr[offset]     = (unsigned char)out0;
+        dst_ptr[offset + 1] = (unsigned char)out1;
+        dst_ptr[offset + 2] = (unsigned char)out2;
+        dst_ptr[offset + 3] = (unsigned char)out3;
+        dst_ptr[offset + 4] = (unsigned char)out4;
+    };
+
+    return rs_submit_split<IMPL_VIDEO_YUV422YCBCR10BE, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr, 2, 1, pixel);
+}
+
+template <impl_interp_mtd INTERP_METHOD>
+IMPL_STATUS impl_resize_yuv422ycbcr10be(struct impl_resize_params *prs, impl_resize_context *prst,
+                                        unsigned char *src_ptr, unsigned char *dst_ptr, void *dep_evt) {
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    struct rs_ycbcr10be_frame src = {src_ptr, (uint32_t)prs->src_width * 5 / 2};
+    return impl_resize_yuv422ycbcr10be_src<INTERP_METHOD>(prs, prst, src, dst_ptr, dep_evt);
+}
+
+template <impl_interp_mtd INTERP_METHOD>
+IMPL_STATUS impl_resize_yuv422ycbcr10be_sg(struct impl_resize_params *prs, const impl_resize_context *prst,
+                                           const struct sg_kernel_src &sg, unsigned char *dst_ptr,
+                                           sycl::event &index_evt) {
+    struct rs_ycbcr10be_sg src = {sg};
+    return impl_resize_yuv422ycbcr10be_src<INTERP_METHOD>(prs, prst, src, dst_ptr, &index_evt);
 }
 
 template <impl_interp_mtd INTERP_METHOD>
 IMPL_STATUS impl_resize_v210(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr_c,
                              unsigned char *dst_ptr_c, void *dep_evt) {
-    (void)prst;
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
     IMPL_ASSERT(src_ptr_c != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr_c != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
-
-    queue q         = *(queue *)(prs->pq);
-    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
-    auto event      = q.submit([&](sycl::handler &h) {
-        uint32_t pitch     = prs->pitch_pixel * 4 / 6;
-        uint32_t src_pitch = src_width * 4 / 6;
-        uint32_t offset_x  = prs->offset_x;
-        uint32_t offset_y  = prs->offset_y;
-
-        try {
-            unsigned int *src_ptr = (unsigned int *)src_ptr_c;
-            unsigned int *dst_ptr = (unsigned int *)dst_ptr_c;
-            if (dep_evt != NULL) {
-                auto d_evt = *(sycl::event *)dep_evt;
-                h.depends_on(d_evt);
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
+
+    uint32_t pitch     = prs->pitch_pixel * 4 / 6;
+    uint32_t src_pitch = src_width * 4 / 6;
+    uint32_t offset_x  = rs_offset_x(prs);
+    uint32_t offset_y  = rs_offset_y(prs);
+
+    unsigned int *src_ptr = (unsigned int *)src_ptr_c;
+    unsigned int *dst_ptr = (unsigned int *)dst_ptr_c;
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
+
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        uint32_t sx            = 6 * gx;
+        uint32_t sy            = gy;
+        float dst_lm[6];
+        float dst_cb[3];
+        float dst_cr[3];
+
+        float yw[datasize];
+        uint32_t yid[datasize];
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
+
+        { // Y0 ~Y5
+            auto readlm = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
+                return read_v210_lm(src_ptr, y, x, src_pitch);
+            };
+            for (int i = 0; i < 6; i++) {
+                float xw[datasize];
+                uint32_t xid[datasize];
+                get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+                dst_lm[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
             }
-            h.parallel_for(sycl::range<2>(dst_height, dst_width / 6), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-                uint32_t sx            = 6 * item[1];
-                uint32_t sy            = item[0];
-                float dst_lm[6];
-                float dst_cb[3];
-                float dst_cr[3];
-
-                float yw[datasize];
-                uint32_t yid[datasize];
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
-
-                { // Y0 ~Y5
-                    auto readlm = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
-                        return read_v210_lm(src_ptr, y, x, src_pitch);
-                    };
-                    for (int i = 0; i < 6; i++) {
-                        float xw[datasize];
-                        uint32_t xid[datasize];
-                        get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                        if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                            dst_lm[i] = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                        else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                            dst_lm[i] = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
-                    }
-                }
+        }
 
-                { // UV
-                    auto readcr = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
-                        return read_v210_cr(src_ptr, y, x, src_pitch);
-                    };
-                    auto readcb = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
-                        return read_v210_cb(src_ptr, y, x, src_pitch);
-                    };
-                    for (int i = 0; i < 3; i++) {
-                        float xw[datasize];
-                        uint32_t xid[datasize];
-                        get_idw<INTERP_METHOD>(sx / 2 + i, coef_width, src_width / 2, xid, xw);
-
-                        if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                            dst_cr[i] = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                        else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                            dst_cr[i] = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-
-                        if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                            dst_cb[i] = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                        else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                            dst_cb[i] = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
-                    }
-                }
+        { // UV
+            auto readcr = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
+                return read_v210_cr(src_ptr, y, x, src_pitch);
+            };
+            auto readcb = [&src_ptr, &src_pitch](uint32_t y, uint32_t x) {
+                return read_v210_cb(src_ptr, y, x, src_pitch);
+            };
+            for (int i = 0; i < 3; i++) {
+                float xw[datasize];
+                uint32_t xid[datasize];
+                get_idw<INTERP_METHOD, CLAMP>(sx / 2 + i, coef_width, src_width / 2, xid, xw, origin_x / 2);
+
+                dst_cr[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+
+                dst_cb[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+            }
+        }
 
-                uint32_t offset = mad24(sy + offset_y, pitch, (sx + offset_x) * 4 / 6);
+        uint32_t offset = mad24(sy + offset_y, pitch, (sx + offset_x) * 4 / 6);
 
-                const auto dst_dw0 = ((unsigned int)dst_cb[0] & 0x3ff) | (((unsigned int)dst_lm[0] & 0x3ff) << 10) |
-                                     (((unsigned int)dst_cr[0] & 0x3ff) << 20);
+        const auto dst_dw0 = ((unsigned int)dst_cb[0] & 0x3ff) | (((unsigned int)dst_lm[0] & 0x3ff) << 10) |
+                             (((unsigned int)dst_cr[0] & 0x3ff) << 20);
 
-                const auto dst_dw1 = ((unsigned int)dst_lm[1] & 0x3ff) | (((unsigned int)dst_cb[1] & 0x3ff) << 10) |
-                                     (((unsigned int)dst_lm[2] & 0x3ff) << 20);
+        const auto dst_dw1 = ((unsigned int)dst_lm[1] & 0x3ff) | (((unsigned int)dst_cb[1] & 0x3ff) << 10) |
+                             (((unsigned int)dst_lm[2] & 0x3ff) << 20);
 
-                const auto dst_dw2 = ((unsigned int)dst_cr[1] & 0x3ff) | (((unsigned int)dst_lm[3] & 0x3ff) << 10) |
-                                     (((unsigned int)dst_cb[2] & 0x3ff) << 20);
+        const auto dst_dw2 = ((unsigned int)dst_cr[1] & 0x3ff) | (((unsigned int)dst_lm[3] & 0x3ff) << 10) |
+                             (((unsigned int)dst_cb[2] & 0x3ff) << 20);
 
-                const auto dst_dw3 = ((unsigned int)dst_lm[4] & 0x3ff) | (((unsigned int)dst_cr[2] & 0x3ff) << 10) |
-                                     (((unsigned int)dst_lm[5] & 0x3ff) << 20);
+        const auto dst_dw3 = ((unsigned int)dst_lm[4] & 0x3ff) | (((unsigned int)dst_cr[2] & 0x3ff) << 10) |
+                             (((unsigned int)dst_lm[5] & 0x3ff) << 20);
 
-                dst_ptr[offset]     = (unsigned int)(dst_dw0);
-                dst_ptr[offset + 1] = (unsigned int)(dst_dw1);
-                dst_ptr[offset + 2] = (unsigned int)(dst_dw2);
-                dst_ptr[offset + 3] = (unsigned int)(dst_dw3);
-            });
-        } catch (std::exception e) {
-            err("%s, SYCL exception caught: %s\n", __func__, e.what());
-            ret = IMPL_STATUS_FAIL;
-        }
-    });
+        dst_ptr[offset]     = (unsigned int)(dst_dw0);
+        dst_ptr[offset + 1] = (unsigned int)(dst_dw1);
+        dst_ptr[offset + 2] = (unsigned int)(dst_dw2);
+        dst_ptr[offset + 3] = (unsigned int)(dst_dw3);
+    };
 
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
-    return ret;
+    return rs_submit_split<IMPL_VIDEO_V210, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr_c, 6, 1, pixel);
 }
 
 template <impl_interp_mtd INTERP_METHOD>
 IMPL_STATUS impl_resize_y210(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr_c,
                              unsigned char *dst_ptr_c, void *dep_evt) {
-    (void)prst;
     IMPL_ASSERT(prs->pq != NULL, "queue is null");
     IMPL_ASSERT(src_ptr_c != NULL, "src_ptr is null");
     IMPL_ASSERT(dst_ptr_c != NULL, "dst_ptr is null");
     uint32_t src_width  = prs->src_width;
     uint32_t src_height = prs->src_height;
-    uint32_t dst_width  = prs->dst_width;
-    uint32_t dst_height = prs->dst_height;
-    float coef_width    = (float)prs->src_width / (float)prs->dst_width;
-    float coef_height   = (float)prs->src_height / (float)prs->dst_height;
+    float coef_width    = rs_coef_width(prs);
+    float coef_height   = rs_coef_height(prs);
+    float origin_x      = rs_origin_x(prs);
+    float origin_y      = rs_origin_y(prs);
+
+    const uint32_t pitch    = prs->pitch_pixel * 2;
+    const uint32_t offset_x = rs_offset_x(prs);
+    const uint32_t offset_y = rs_offset_y(prs);
+    uint32_t pitch_src      = src_width * 2;
+
+    unsigned short *src_ptr = (unsigned short *)src_ptr_c;
+    unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
+
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+
+        uint32_t sx = 2 * gx;
+        uint32_t sy = gy;
+
+        float dst_lm[2];
+        float dst_cb;
+        float dst_cr;
+
+        auto readlm = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
+            auto off = mad24(x / 2, (uint32_t)4, (x % 2) * 2);
+            return ((src_ptr[mad24(y, pitch_src, off)]) >> 6);
+        };
+
+        float yw[datasize];
+        uint32_t yid[datasize];
+
+        // Y0 Y1
+        get_idw<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+        for (uint32_t i = 0; i < 2; i++) {
+            float xw[datasize];
+            uint32_t xid[datasize];
+            get_idw<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+
+            dst_lm[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+        }
+
+        // UV
+        {
+            auto readcr = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
+                auto off = mad24(x, (uint32_t)4, (uint32_t)1);
+                return (src_ptr[mad24(y, pitch_src, off)] >> 6);
+            };
+            auto readcb = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
+                auto off = mad24(x, (uint32_t)4, (uint32_t)3);
+                return (src_ptr[mad24(y, pitch_src, off)] >> 6);
+            };
+
+            float xw[datasize];
+            uint32_t xid[datasize];
+            get_idw<INTERP_METHOD, CLAMP>(sx / 2, coef_width, src_width / 2, xid, xw, origin_x / 2);
+
+            dst_cr = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+
+            dst_cb = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+        }
+
+        uint32_t offset     = mad24(sy + offset_y, pitch, (sx + offset_x) * 2);
+        dst_ptr[offset]     = ((unsigned short)dst_lm[0] << 6) & 0xffc0;
+        dst_ptr[offset + 1] = ((unsigned short)dst_cr << 6) & 0xffc0;
+        dst_ptr[offset + 2] = ((unsigned short)dst_lm[1] << 6) & 0xffc0;
+        dst_ptr[offset + 3] = ((unsigned short)dst_cb << 6) & 0xffc0;
+    };
+
+    return rs_submit_split<IMPL_VIDEO_Y210, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr_c, 2, 1, pixel);
+}
+
+/* output rows of a separable resize work-group */
+#define RS_TILE_ROWS 8
+/* output luma pixels per row of a separable resize work-group */
+#define RS_TILE_PIXELS 48
+/* largest vertical downscale ratio the local tile of the separable resize covers */
+#define RS_SEPARABLE_MAX_COEF 2.0f
+
+/* horizontal taps of one source row, same summation order as pixel_interp_* */
+template <impl_interp_mtd INTERP_METHOD, class Func>
+inline float pixel_interp_row(uint32_t xid[], float xw[], uint32_t y, Func read) {
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR) {
+        return (float)read(y, xid[0]) * xw[0] + (float)read(y, xid[1]) * xw[1];
+    } else {
+        float value[4];
+        value[0] = read(y, xid[0]);
+        value[1] = read(y, xid[1]);
+        value[2] = read(y, xid[2]);
+        value[3] = read(y, xid[3]);
+        return dot(*(vec<float, 4> *)value, *(vec<float, 4> *)xw);
+    }
+}
+
+/* vertical taps over horizontally filtered rows, tile(row) returns the row value */
+template <impl_interp_mtd INTERP_METHOD, class Func> inline float pixel_interp_col(uint32_t yid[], float yw[], Func tile) {
+    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR) {
+        return tile(yid[0]) * yw[0] + tile(yid[1]) * yw[1];
+    } else {
+        float col[4];
+        col[0] = tile(yid[0]);
+        col[1] = tile(yid[1]);
+        col[2] = tile(yid[2]);
+        col[3] = tile(yid[3]);
+        return dot(*(vec<float, 4> *)col, *(vec<float, 4> *)yw);
+    }
+}
+
+/**
+ * Separable resize. A work-group covers RS_TILE_ROWS x RS_TILE_PIXELS output pixels,
+ * it first filters every source row the tile needs horizontally into local memory,
+ * then each work item filters its pixels vertically from there. Taps per output
+ * sample drop from datasize^2 to 2 * datasize and source rows are read sequentially.
+ * Results are bit exact with the direct kernels, the summation order is the same.
+ * The tile holds the source rows of vertical ratios up to RS_SEPARABLE_MAX_COEF.
+ */
+template <impl_video_format FORMAT, impl_interp_mtd INTERP_METHOD>
+IMPL_STATUS impl_resize_separable(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr,
+                                  unsigned char *dst_ptr, void *dep_evt) {
+    (void)prst;
+    IMPL_ASSERT(prs->pq != NULL, "queue is null");
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
+    using fmt                  = rs_format<FORMAT>;
+    constexpr int datasize     = GetDataSize<INTERP_METHOD>();
+    constexpr int group_width  = fmt::group_width;
+    constexpr int tile_groups  = RS_TILE_PIXELS / group_width;
+    constexpr int tile_rows    = (int)(RS_TILE_ROWS * RS_SEPARABLE_MAX_COEF) + datasize;
+    constexpr int tile_threads = RS_TILE_ROWS * tile_groups;
+    uint32_t src_width         = prs->src_width;
+    uint32_t src_height        = prs->src_height;
+    uint32_t dst_width         = rs_dst_width(prs);
+    uint32_t dst_height        = rs_dst_height(prs);
+    float coef_width           = rs_coef_width(prs);
+    float coef_height          = rs_coef_height(prs);
+    float origin_x             = rs_origin_x(prs);
+    float origin_y             = rs_origin_y(prs);
+    uint32_t groups            = dst_width / group_width;
 
     queue q         = *(queue *)(prs->pq);
     IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
     auto event      = q.submit([&](sycl::handler &h) {
-        const uint32_t pitch    = prs->pitch_pixel * 2;
-        const uint32_t offset_x = prs->offset_x;
-        const uint32_t offset_y = prs->offset_y;
-        uint32_t pitch_src      = src_width * 2;
+        const uint32_t pitch    = prs->pitch_pixel;
+        const uint32_t height   = prs->surface_height;
+        const uint32_t offset_x = rs_offset_x(prs);
+        const uint32_t offset_y = rs_offset_y(prs);
+        // chroma planes of 4:2:0 formats are resized on half height rows
+        const uint32_t src_cheight = fmt::is_420 ? src_height / 2 : src_height;
+        const float origin_cy      = fmt::is_420 ? origin_y / 2 : origin_y;
 
-        unsigned short *src_ptr = (unsigned short *)src_ptr_c;
-        unsigned short *dst_ptr = (unsigned short *)dst_ptr_c;
         try {
             if (dep_evt != NULL) {
                 auto d_evt = *(sycl::event *)dep_evt;
                 h.depends_on(d_evt);
             }
-            h.parallel_for(sycl::range(dst_height, dst_width / 2), [=](sycl::item<2> item) {
-                constexpr int datasize = GetDataSize<INTERP_METHOD>();
-
-                uint32_t sx = 2 * item[1];
-                uint32_t sy = item[0];
-
-                float dst_lm[2];
-                float dst_cb;
-                float dst_cr;
-
-                auto readlm = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                    auto off = mad24(x / 2, (uint32_t)4, (x % 2) * 2);
-                    return ((src_ptr[mad24(y, pitch_src, off)]) >> 6);
+            sycl::local_accessor<float, 1> lm_tile(sycl::range<1>(tile_rows * RS_TILE_PIXELS), h);
+            sycl::local_accessor<float, 1> cb_tile(sycl::range<1>(tile_rows * RS_TILE_PIXELS / 2), h);
+            sycl::local_accessor<float, 1> cr_tile(sycl::range<1>(tile_rows * RS_TILE_PIXELS / 2), h);
+            sycl::range<2> global((dst_height + RS_TILE_ROWS - 1) / RS_TILE_ROWS * RS_TILE_ROWS,
+                                  (groups + tile_groups - 1) / tile_groups * tile_groups);
+            h.parallel_for(sycl::nd_range<2>(global, sycl::range<2>(RS_TILE_ROWS, tile_groups)),
+                           [=](sycl::nd_item<2> item) {
+                const uint32_t tile_y = item.get_group(0) * RS_TILE_ROWS;
+                const uint32_t tile_x = item.get_group(1) * RS_TILE_PIXELS;
+                const uint32_t lid    = item.get_local_linear_id();
+                const uint32_t last_y = sycl::min(tile_y + RS_TILE_ROWS, dst_height) - 1;
+                const uint32_t cols   = sycl::min((uint32_t)RS_TILE_PIXELS, dst_width - tile_x);
+                auto readlm           = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_lm(src_ptr, src_width, src_height, y, x);
+                };
+                auto readcb = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_cb(src_ptr, src_width, src_height, y, x);
+                };
+                auto readcr = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_cr(src_ptr, src_width, src_height, y, x);
                 };
 
                 float yw[datasize];
                 uint32_t yid[datasize];
-
-                // Y0 Y1
-                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw);
-#pragma unroll
-                for (uint32_t i = 0; i < 2; i++) {
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    get_idw<INTERP_METHOD>(sx + i, coef_width, src_width, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_lm[i] = pixel_interp_bilinear(xid, xw, yid, yw, readlm);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_lm[i] = pixel_interp_bicubic(xid, xw, yid, yw, readlm);
+                float xw[datasize];
+                uint32_t xid[datasize];
+
+                // source rows of the tile, ids are clamped so every row in between is used
+                get_idw<INTERP_METHOD>(tile_y, coef_height, src_height, yid, yw, origin_y);
+                const uint32_t lm_y0 = yid[0];
+                get_idw<INTERP_METHOD>(last_y, coef_height, src_height, yid, yw, origin_y);
+                const uint32_t lm_rows = yid[datasize - 1] - lm_y0 + 1;
+                const uint32_t c_first = fmt::is_420 ? tile_y / 2 : tile_y;
+                const uint32_t c_last  = fmt::is_420 ? last_y / 2 : last_y;
+                get_idw<INTERP_METHOD>(c_first, coef_height, src_cheight, yid, yw, origin_cy);
+                const uint32_t c_y0 = yid[0];
+                get_idw<INTERP_METHOD>(c_last, coef_height, src_cheight, yid, yw, origin_cy);
+                const uint32_t c_rows = yid[datasize - 1] - c_y0 + 1;
+
+                // horizontal pass
+                for (uint32_t i = lid; i < lm_rows * RS_TILE_PIXELS; i += tile_threads) {
+                    const uint32_t c = i % RS_TILE_PIXELS;
+                    if (c < cols) {
+                        get_idw<INTERP_METHOD>(tile_x + c, coef_width, src_width, xid, xw, origin_x);
+                        lm_tile[i] = pixel_interp_row<INTERP_METHOD>(xid, xw, lm_y0 + i / RS_TILE_PIXELS, readlm);
+                    }
                 }
-
-                // UV
-                {
-                    auto readcr = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                        auto off = mad24(x, (uint32_t)4, (uint32_t)1);
-                        return (src_ptr[mad24(y, pitch_src, off)] >> 6);
-                    };
-                    auto readcb = [&src_ptr, &pitch_src](uint32_t y, uint32_t x) {
-                        auto off = mad24(x, (uint32_t)4, (uint32_t)3);
-                        return (src_ptr[mad24(y, pitch_src, off)] >> 6);
-                    };
-
-                    float xw[datasize];
-                    uint32_t xid[datasize];
-                    get_idw<INTERP_METHOD>(sx / 2, coef_width, src_width / 2, xid, xw);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_cr = pixel_interp_bilinear(xid, xw, yid, yw, readcr);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_cr = pixel_interp_bicubic(xid, xw, yid, yw, readcr);
-
-                    if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BILINEAR)
-                        dst_cb = pixel_interp_bilinear(xid, xw, yid, yw, readcb);
-                    else if constexpr (INTERP_METHOD == IMPL_INTERP_MTD_BICUBIC)
-                        dst_cb = pixel_interp_bicubic(xid, xw, yid, yw, readcb);
+                for (uint32_t i = lid; i < c_rows * RS_TILE_PIXELS / 2; i += tile_threads) {
+                    const uint32_t c = i % (RS_TILE_PIXELS / 2);
+                    if (c < cols / 2) {
+                        get_idw<INTERP_METHOD>(tile_x / 2 + c, coef_width, src_width / 2, xid, xw, origin_x / 2);
+                        const uint32_t y = c_y0 + i / (RS_TILE_PIXELS / 2);
+                        cb_tile[i]       = pixel_interp_row<INTERP_METHOD>(xid, xw, y, readcb);
+                        cr_tile[i]       = pixel_interp_row<INTERP_METHOD>(xid, xw, y, readcr);
+                    }
                 }
-
-                uint32_t offset     = mad24(sy + offset_y, pitch, (sx + offset_x) * 2);
-                dst_ptr[offset]     = ((unsigned short)dst_lm[0] << 6) & 0xffc0;
-                dst_ptr[offset + 1] = ((unsigned short)dst_cr << 6) & 0xffc0;
-                dst_ptr[offset + 2] = ((unsigned short)dst_lm[1] << 6) & 0xffc0;
-                dst_ptr[offset + 3] = ((unsigned short)dst_cb << 6) & 0xffc0;
+                sycl::group_barrier(item.get_group());
+
+                // vertical pass
+                const uint32_t sy  = tile_y + item.get_local_id(0);
+                const uint32_t col = item.get_local_id(1) * group_width;
+                if (sy >= dst_height || col >= cols)
+                    return;
+                float dst_lm[group_width];
+                float dst_cb[group_width / 2];
+                float dst_cr[group_width / 2];
+                get_idw<INTERP_METHOD>(sy, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+                for (int i = 0; i < group_width; i++)
+                    dst_lm[i] = pixel_interp_col<INTERP_METHOD>(yid, yw, [&](uint32_t y) {
+                        return lm_tile[(y - lm_y0) * RS_TILE_PIXELS + col + i];
+                    });
+                const bool chroma = !fmt::is_420 || (sy % 2) == 0;
+                if (chroma) {
+                    get_idw<INTERP_METHOD>(fmt::is_420 ? sy / 2 : sy, coef_height, src_cheight, yid, yw, origin_cy);
+#pragma unroll
+                    for (int i = 0; i < group_width / 2; i++) {
+                        const uint32_t c = col / 2 + i;
+                        dst_cb[i]        = pixel_interp_col<INTERP_METHOD>(yid, yw, [&](uint32_t y) {
+                            return cb_tile[(y - c_y0) * (RS_TILE_PIXELS / 2) + c];
+                        });
+                        dst_cr[i]        = pixel_interp_col<INTERP_METHOD>(yid, yw, [&](uint32_t y) {
+                            return cr_tile[(y - c_y0) * (RS_TILE_PIXELS / 2) + c];
+                        });
+                    }
+                }
+                fmt::write(dst_ptr, pitch, height, tile_x + col, sy, offset_x, offset_y, dst_lm, dst_cb, dst_cr,
+                           chroma);
             });
         } catch (std::exception e) {
             err("%s, SYCL exception caught: %s\n", __func__, e.what());
@@ -687,8 +887,201 @@ IMPL_STATUS impl_resize_y210(struct impl_resize_params *prs, impl_resize_context
         }
     });
 
-    *(sycl::event *)prs->evt = event;
-    if (prs->is_async == 0)
-        event.wait();
+    impl_common_run_done(q, prs->evt, event, prs->is_async);
     return ret;
-}
\ No newline at end of file
+}
+
+/* fractional bits of the fixed-point resize weights */
+#define RS_FIXED_WEIGHT_BITS 14
+/* bits dropped from horizontally filtered rows, keeps the vertical sum within int32 */
+#define RS_FIXED_ROW_SHIFT 8
+
+/* Q14 weights of get_idw, the anchor tap takes the rounding residue so they sum to exactly 1 */
+template <impl_interp_mtd INTERP_METHOD, bool CLAMP = true>
+inline void get_idw_fixed(uint32_t dstid, float coef, uint32_t limit, uint32_t *id, int *weight, float origin) {
+    constexpr int datasize = GetDataSize<INTERP_METHOD>();
+    constexpr int anchor   = datasize / 2 - 1;
+    float fweight[datasize];
+    get_idw<INTERP_METHOD, CLAMP>(dstid, coef, limit, id, fweight, origin);
+    int sum = 0;
+#pragma unroll
+    for (int i = 0; i < datasize; i++) {
+        if (i == anchor)
+            continue;
+        weight[i] = (int)sycl::rint(fweight[i] * (float)(1 << RS_FIXED_WEIGHT_BITS));
+        sum += weight[i];
+    }
+    weight[anchor] = (1 << RS_FIXED_WEIGHT_BITS) - sum;
+}
+
+// read(yid, xid) -> integer sample, result is rounded and clamped to [0, max_value]
+template <impl_interp_mtd INTERP_METHOD, class Func>
+inline int pixel_interp_fixed(uint32_t xid[], int xw[], uint32_t yid[], int yw[], int max_value, Func read) {
+    constexpr int datasize = GetDataSize<INTERP_METHOD>();
+    constexpr int shift    = 2 * RS_FIXED_WEIGHT_BITS - RS_FIXED_ROW_SHIFT;
+    int sum                = 0;
+#pragma unroll
+    for (int j = 0; j < datasize; j++) {
+        int row = 0;
+#pragma unroll
+        for (int i = 0; i < datasize; i++)
+            row += (int)read(yid[j], xid[i]) * xw[i];
+        sum += ((row + (1 << (RS_FIXED_ROW_SHIFT - 1))) >> RS_FIXED_ROW_SHIFT) * yw[j];
+    }
+    return sycl::clamp((sum + (1 << (shift - 1))) >> shift, 0, max_value);
+}
+
+/**
+ * Fixed-point resize. Weights are Q14, rows are accumulated in int32 and kept with
+ * 6 fractional bits for the vertical taps, so 10-bit bicubic still fits int32.
+ * Against the float kernels a sample differs by at most 1, except where bicubic
+ * overshoots the sample range: the float kernels wrap there, this one saturates.
+ */
+template <impl_video_format FORMAT, impl_interp_mtd INTERP_METHOD>
+IMPL_STATUS impl_resize_fixed(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr,
+                              unsigned char *dst_ptr, void *dep_evt) {
+    IMPL_ASSERT(prs->pq != NULL, "queue is null");
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int group_width = fmt::group_width;
+    constexpr int max_value   = (1 << fmt::bit_depth) - 1;
+    uint32_t src_width        = prs->src_width;
+    uint32_t src_height       = prs->src_height;
+    float coef_width          = rs_coef_width(prs);
+    float coef_height         = rs_coef_height(prs);
+    float origin_x            = rs_origin_x(prs);
+    float origin_y            = rs_origin_y(prs);
+
+    const uint32_t pitch       = prs->pitch_pixel;
+    const uint32_t height      = prs->surface_height;
+    const uint32_t offset_x    = rs_offset_x(prs);
+    const uint32_t offset_y    = rs_offset_y(prs);
+    const uint32_t src_cheight = fmt::is_420 ? src_height / 2 : src_height;
+    const float origin_cy      = fmt::is_420 ? origin_y / 2 : origin_y;
+
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
+
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        const uint32_t sx      = gx * group_width;
+        const uint32_t sy      = gy;
+        auto readlm            = [&](uint32_t y, uint32_t x) {
+            return fmt::read_lm(src_ptr, src_width, src_height, y, x);
+        };
+        auto readcb = [&](uint32_t y, uint32_t x) {
+            return fmt::read_cb(src_ptr, src_width, src_height, y, x);
+        };
+        auto readcr = [&](uint32_t y, uint32_t x) {
+            return fmt::read_cr(src_ptr, src_width, src_height, y, x);
+        };
+
+        int yw[datasize], xw[datasize];
+        uint32_t yid[datasize], xid[datasize];
+        // integer results are exact in float, write() rounds or truncates them unchanged
+        float dst_lm[group_width];
+        float dst_cb[group_width / 2];
+        float dst_cr[group_width / 2];
+
+        get_idw_fixed<INTERP_METHOD, CLAMP>(sy, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+        for (int i = 0; i < group_width; i++) {
+            get_idw_fixed<INTERP_METHOD, CLAMP>(sx + i, coef_width, src_width, xid, xw, origin_x);
+            dst_lm[i] = (float)pixel_interp_fixed<INTERP_METHOD>(xid, xw, yid, yw, max_value, readlm);
+        }
+        const bool chroma = !fmt::is_420 || (sy % 2) == 0;
+        if (chroma) {
+            get_idw_fixed<INTERP_METHOD, CLAMP>(fmt::is_420 ? sy / 2 : sy, coef_height, src_cheight, yid, yw,
+                                         origin_cy);
+#pragma unroll
+            for (int i = 0; i < group_width / 2; i++) {
+                get_idw_fixed<INTERP_METHOD, CLAMP>(sx / 2 + i, coef_width, src_width / 2, xid, xw, origin_x / 2);
+                dst_cb[i] = (float)pixel_interp_fixed<INTERP_METHOD>(xid, xw, yid, yw, max_value, readcb);
+                dst_cr[i] = (float)pixel_interp_fixed<INTERP_METHOD>(xid, xw, yid, yw, max_value, readcr);
+            }
+        }
+        fmt::write(dst_ptr, pitch, height, sx, sy, offset_x, offset_y, dst_lm, dst_cb, dst_cr, chroma);
+    };
+
+    return rs_submit_split<FORMAT, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr, group_width, 1, pixel);
+}
+
+/**
+ * Format-generic resize over the rs_format traits, the direct kernel of formats that
+ * have no dedicated one. With UP and DOWN set it is an integer ratio resize, UP:1
+ * upscale or 1:DOWN downscale on both axes, ids and weights then come from
+ * get_idw_ratio instead of fract/clamp per pixel. The interpolation itself is the one
+ * of the direct kernels, so results are bit exact with them.
+ */
+template <impl_video_format FORMAT, impl_interp_mtd INTERP_METHOD, int UP = 0, int DOWN = 0>
+IMPL_STATUS impl_resize_generic(struct impl_resize_params *prs, impl_resize_context *prst, unsigned char *src_ptr,
+                                unsigned char *dst_ptr, void *dep_evt) {
+    IMPL_ASSERT(prs->pq != NULL, "queue is null");
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int group_width = fmt::group_width;
+    uint32_t src_width        = prs->src_width;
+    uint32_t src_height       = prs->src_height;
+    float coef_width          = rs_coef_width(prs);
+    float coef_height         = rs_coef_height(prs);
+    float origin_x            = rs_origin_x(prs);
+    float origin_y            = rs_origin_y(prs);
+
+    const uint32_t pitch       = prs->pitch_pixel;
+    const uint32_t height      = prs->surface_height;
+    const uint32_t offset_x    = rs_offset_x(prs);
+    const uint32_t offset_y    = rs_offset_y(prs);
+    const uint32_t src_cheight = fmt::is_420 ? src_height / 2 : src_height;
+    const float origin_cy      = fmt::is_420 ? origin_y / 2 : origin_y;
+
+    auto pixel = [=](uint32_t gy, uint32_t gx, auto clamp) {
+        constexpr bool CLAMP = decltype(clamp)::value;
+
+        constexpr int datasize = GetDataSize<INTERP_METHOD>();
+        const uint32_t sx      = gx * group_width;
+        const uint32_t sy      = gy;
+        auto readlm            = [&](uint32_t y, uint32_t x) {
+            return fmt::read_lm(src_ptr, src_width, src_height, y, x);
+        };
+        auto readcb = [&](uint32_t y, uint32_t x) {
+            return fmt::read_cb(src_ptr, src_width, src_height, y, x);
+        };
+        auto readcr = [&](uint32_t y, uint32_t x) {
+            return fmt::read_cr(src_ptr, src_width, src_height, y, x);
+        };
+
+        auto idw = [](uint32_t dstid, float coef, uint32_t limit, uint32_t *id, float *w, float origin) {
+            if constexpr (UP == 0)
+                get_idw<INTERP_METHOD, CLAMP>(dstid, coef, limit, id, w, origin);
+            else
+                get_idw_ratio<INTERP_METHOD, UP, DOWN, CLAMP>(dstid, limit, id, w);
+        };
+
+        float yw[datasize], xw[datasize];
+        uint32_t yid[datasize], xid[datasize];
+        float dst_lm[group_width];
+        float dst_cb[group_width / 2];
+        float dst_cr[group_width / 2];
+
+        idw(sy, coef_height, src_height, yid, yw, origin_y);
+#pragma unroll
+        for (int i = 0; i < group_width; i++) {
+            idw(sx + i, coef_width, src_width, xid, xw, origin_x);
+            dst_lm[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readlm);
+        }
+        const bool chroma = !fmt::is_420 || (sy % 2) == 0;
+        if (chroma) {
+            idw(fmt::is_420 ? sy / 2 : sy, coef_height, src_cheight, yid, yw, origin_cy);
+#pragma unroll
+            for (int i = 0; i < group_width / 2; i++) {
+                idw(sx / 2 + i, coef_width, src_width / 2, xid, xw, origin_x / 2);
+                dst_cb[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcb);
+                dst_cr[i] = pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, readcr);
+            }
+        }
+        fmt::write(dst_ptr, pitch, height, sx, sy, offset_x, offset_y, dst_lm, dst_cb, dst_cr, chroma);
+    };
+
+    return rs_submit_split<FORMAT, INTERP_METHOD>(prs, prst, dep_evt, dst_ptr, group_width, 1, pixel);
+}
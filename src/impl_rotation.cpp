@@ -52,36 +52,6 @@ IMPL_STATUS rotation_i420(struct impl_rotation_params *prt, unsigned char *buf_i
                         memcpy(buf_out + dst_y * dst_width, buf_in + dst_y * src_width, src_width);
                     }
                 });
-            } else if (angle == 90) {
-                h.parallel_for(sycl::range<2>(dst_height * 2, dst_width / 2), [=](sycl::id<2> idx) {
-                    const int dst_y = idx[0];
-                    const int dst_x = idx[1];
-                    bool is_uv      = (dst_y >= dst_height);
-                    if (is_uv) {
-                        bool is_u               = is_uv && (dst_y < (dst_height * 3 / 2));
-                        unsigned int dst_y_uv   = dst_y - (is_u ? dst_height : (dst_height * 3 / 2));
-                        unsigned char *src0_ptr = is_u ? srcu_ptr : srcv_ptr;
-                        unsigned char *dst0_ptr = is_u ? dstu_ptr : dstv_ptr;
-
-                        int src_x = dst_y_uv;
-                        int src_y = src_height / 2 - dst_x - 1;
-                        dst_write_char(dst0_ptr, dst_y_uv, dst_x, dst_width / 2,
-                                                     *(src0_ptr + src_y * (src_width / 2) + src_x));
-                    } else {
-                        int dst_x_luma_1 = dst_x * 2;
-                        int dst_x_luma_2 = dst_x * 2 + 1;
-
-                        int src_x_luma_1 = dst_y;
-                        int src_x_luma_2 = dst_y;
-                        int src_y_luma_1 = src_height - dst_x_luma_1 - 1;
-                        int src_y_luma_2 = src_height - dst_x_luma_2 - 1;
-
-                        dst_write_char(buf_out, dst_y, dst_x_luma_1, dst_width,
-                                                     *(buf_in + src_y_luma_1 * src_width + src_x_luma_1));
-                        dst_write_char(buf_out, dst_y, dst_x_luma_2, dst_width,
-                                                     *(buf_in + src_y_luma_2 * src_width + src_x_luma_2));
-                    }
-                });
             } else if (angle == 180) {
                 h.parallel_for(sycl::range<2>(dst_height * 2, dst_width / 2), [=](sycl::id<2> idx) {
                     const int dst_y = idx[0];
@@ -111,33 +81,55 @@ IMPL_STATUS rotation_i420(struct impl_rotation_params *prt, unsigned char *buf_i
                                                      *(buf_in + src_y_luma_2 * src_width + src_x_luma_2));
                     }
                 });
-            } else if (angle == 270) {
-                h.parallel_for(sycl::range<2>(dst_height * 2, dst_width / 2), [=](sycl::id<2> idx) {
-                    const int dst_y = idx[0];
-                    const int dst_x = idx[1];
-                    bool is_uv      = (dst_y >= dst_height);
-                    if (is_uv) {
-                        bool is_u               = is_uv && (dst_y < (dst_height * 3 / 2));
-                        unsigned int dst_y_uv   = dst_y - (is_u ? dst_height : (dst_height * 3 / 2));
-                        unsigned char *src0_ptr = is_u ? srcu_ptr : srcv_ptr;
-                        unsigned char *dst0_ptr = is_u ? dstu_ptr : dstv_ptr;
-
-                        int src_x = src_width / 2 - dst_y_uv - 1;
-                        int src_y = dst_x;
-                        dst_write_char(dst0_ptr, dst_y_uv, dst_x, dst_width / 2,
-                                                     *(src0_ptr + src_y * (src_width / 2) + src_x));
-                    } else {
-                        int dst_x_luma_1 = dst_x * 2;
-                        int dst_x_luma_2 = dst_x * 2 + 1;
-
-                        int src_x_luma_1 = src_width - dst_y - 1;
-                        int src_x_luma_2 = src_width - dst_y - 1;
-                        int src_y_luma_1 = dst_x_luma_1;
-                        int src_y_luma_2 = dst_x_luma_2;
-                        dst_write_char(buf_out, dst_y, dst_x_luma_1, dst_width,
-                                                     *(buf_in + src_y_luma_1 * src_width + src_x_luma_1));
-                        dst_write_char(buf_out, dst_y, dst_x_luma_2, dst_width,
-                                                     *(buf_in + src_y_luma_2 * src_width + src_x_luma_2));
+            } else {
+                // 90 and 270 transpose RT_TILE x RT_TILE tiles of every plane through local memory, loads
+                // and stores are both along rows. Tiles are laid out on the destination, luma tiles first
+                const bool clockwise = angle == 90;
+                const int tiles_x    = (dst_width + RT_TILE - 1) / RT_TILE;
+                const int tiles_y    = (dst_height + RT_TILE - 1) / RT_TILE;
+                const int tiles_cy   = (dst_height / 2 + RT_TILE - 1) / RT_TILE;
+                sycl::local_accessor<unsigned char, 1> tile(sycl::range<1>(RT_TILE * (RT_TILE + 1)), h);
+                sycl::range<2> global((tiles_y + tiles_cy * 2) * RT_TILE_ROWS, tiles_x * RT_TILE);
+                h.parallel_for(sycl::nd_range<2>(global, sycl::range<2>(RT_TILE_ROWS, RT_TILE)),
+                               [=](sycl::nd_item<2> item) {
+                    int ty          = item.get_group(0);
+                    const int plane = ty < tiles_y ? 0 : (ty < tiles_y + tiles_cy ? 1 : 2);
+                    ty -= plane == 0 ? 0 : (plane == 1 ? tiles_y : tiles_y + tiles_cy);
+                    const int shift = plane == 0 ? 0 : 1;
+                    const int sw    = src_width >> shift;
+                    const int sh    = src_height >> shift;
+                    const int dw    = dst_width >> shift;
+                    const int dh    = dst_height >> shift;
+                    const int dy0   = ty * RT_TILE;
+                    const int dx0   = item.get_group(1) * RT_TILE;
+                    // chroma planes have fewer tile columns, the whole group leaves before the barrier
+                    if (dx0 >= dw)
+                        return;
+                    const unsigned char *src = plane == 0 ? buf_in : (plane == 1 ? srcu_ptr : srcv_ptr);
+                    unsigned char *dst       = plane == 0 ? buf_out : (plane == 1 ? dstu_ptr : dstv_ptr);
+                    const int ly             = item.get_local_id(0);
+                    const int lx             = item.get_local_id(1);
+
+                    // source rectangle of the destination tile
+                    const int sy0 = clockwise ? sh - dx0 - RT_TILE : dx0;
+                    const int sx0 = clockwise ? dy0 : sw - dy0 - RT_TILE;
+                    for (int r = ly; r < RT_TILE; r += RT_TILE_ROWS) {
+                        const int sy = sy0 + r;
+                        const int sx = sx0 + lx;
+                        if (sy >= 0 && sy < sh && sx >= 0 && sx < sw)
+                            tile[r * (RT_TILE + 1) + lx] = src[sy * sw + sx];
+                    }
+                    sycl::group_barrier(item.get_group());
+
+                    for (int r = ly; r < RT_TILE; r += RT_TILE_ROWS) {
+                        const int y = dy0 + r;
+                        const int x = dx0 + lx;
+                        if (y >= dh || x >= dw)
+                            continue;
+                        if (clockwise)
+                            dst[y * dw + x] = tile[(RT_TILE - 1 - lx) * (RT_TILE + 1) + r];
+                        else
+                            dst[y * dw + x] = tile[lx * (RT_TILE + 1) + RT_TILE - 1 - r];
                     }
                 });
             }
@@ -146,10 +138,7 @@ IMPL_STATUS rotation_i420(struct impl_rotation_params *prt, unsigned char *buf_i
             ret = IMPL_STATUS_FAIL;
         }
     });
-    *(sycl::event *)prt->evt = event;
-    if (prt->is_async == 0) {
-        event.wait();
-    }
+    impl_common_run_done(q, prt->evt, event, prt->is_async);
     return ret;
 }
 
@@ -179,272 +168,6 @@ IMPL_STATUS rotation_v210(struct impl_rotation_params *prt, unsigned char *buf_i
                     memcpy(buf_out + dst_y * dst_width * 2 / 3, buf_in + dst_y * src_width * 2 / 3,
                                          src_width * 2 / 3 * sizeof(unsigned int));
                 });
-            } else if (angle == 90) {
-                int dst_pitch = (dst_width + 47) / 48 * 48;
-                int src_pitch = src_width * 2 / 3;
-
-                h.parallel_for(sycl::range<2>(dst_height / 6, dst_width / 6), [=](sycl::id<2> idx) {
-                    const auto y_pixel_dst = idx[0] * 6;
-                    const auto y_pixel_src = idx[0] * 4;
-                    const auto x_pixel_dst = idx[1] * 4;
-                    const auto x_pixel_src = idx[1] * 6;
-
-                    // pixel 0
-                    const unsigned int pixel0_r0 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 1, y_pixel_src, src_pitch);
-                    unsigned int lm0 = (((unsigned int)pixel0_r0 >> 10) & 0x3ff);
-
-                    unsigned int cb0_p0 = (((unsigned int)pixel0_r0) & 0x3ff);
-                    unsigned int cr0_p0 = (((unsigned int)pixel0_r0 >> 20) & 0x3ff);
-
-                    const unsigned int pixel0_r1 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 2, y_pixel_src, src_pitch);
-                    unsigned int lm1 = (((unsigned int)pixel0_r1 >> 10) & 0x3ff);
-
-                    const unsigned int pixel0_r2 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 3, y_pixel_src, src_pitch);
-                    unsigned int lm2 = (((unsigned int)pixel0_r2 >> 10) & 0x3ff);
-
-                    unsigned int cb1_p0 = (((unsigned int)pixel0_r2) & 0x3ff);
-                    unsigned int cr1_p0 = (((unsigned int)pixel0_r2 >> 20) & 0x3ff);
-
-                    const unsigned int pixel0_r3 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 4, y_pixel_src, src_pitch);
-                    unsigned int lm3 = (((unsigned int)pixel0_r3 >> 10) & 0x3ff);
-
-                    const unsigned int pixel0_r4 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 5, y_pixel_src, src_pitch);
-                    unsigned int lm4 = (((unsigned int)pixel0_r4 >> 10) & 0x3ff);
-
-                    unsigned int cb2_p0 = (((unsigned int)pixel0_r4) & 0x3ff);
-                    unsigned int cr2_p0 = (((unsigned int)pixel0_r4 >> 20) & 0x3ff);
-
-                    const unsigned int pixel0_r5 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 6, y_pixel_src, src_pitch);
-                    unsigned int lm5 = (((unsigned int)pixel0_r5 >> 10) & 0x3ff);
-
-                    unsigned int dst_pixel0 = cb0_p0 | lm0 << 10 | cr0_p0 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    unsigned int dst_pixel1 = lm1 | cb1_p0 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    unsigned int dst_pixel2 = cr1_p0 | lm3 << 10 | cb2_p0 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    unsigned int dst_pixel3 = lm4 | cr2_p0 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 1
-                    const unsigned int pixel1_r0 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 1, y_pixel_src + 1, src_pitch);
-                    const unsigned int pixel2_r0 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 1, y_pixel_src + 2, src_pitch);
-                    lm0                 = (((unsigned int)pixel1_r0) & 0x3ff);
-                    unsigned int cb0_p2 = (((unsigned int)pixel1_r0 >> 10) & 0x3ff);
-                    unsigned int cr0_p2 = (((unsigned int)pixel2_r0) & 0x3ff);
-                    unsigned int cb0_p1 = (cb0_p0 + cb0_p2) / 2;
-                    unsigned int cr0_p1 = (cr0_p0 + cr0_p2) / 2;
-
-                    const unsigned int pixel1_r1 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 2, y_pixel_src + 1, src_pitch);
-                    lm1 = (((unsigned int)pixel1_r1) & 0x3ff);
-
-                    const unsigned int pixel1_r2 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 3, y_pixel_src + 1, src_pitch);
-                    const unsigned int pixel2_r2 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 3, y_pixel_src + 2, src_pitch);
-                    lm2                 = (((unsigned int)pixel1_r2) & 0x3ff);
-                    unsigned int cb1_p2 = (((unsigned int)pixel1_r2 >> 10) & 0x3ff);
-                    unsigned int cr1_p2 = (((unsigned int)pixel2_r2) & 0x3ff);
-                    unsigned int cb1_p1 = (cb1_p0 + cb1_p2) / 2;
-                    unsigned int cr1_p1 = (cr1_p0 + cr1_p2) / 2;
-
-                    const unsigned int pixel1_r3 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 4, y_pixel_src + 1, src_pitch);
-                    lm3 = (((unsigned int)pixel1_r3) & 0x3ff);
-
-                    const unsigned int pixel1_r4 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 5, y_pixel_src + 1, src_pitch);
-                    const unsigned int pixel2_r4 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 5, y_pixel_src + 2, src_pitch);
-                    unsigned int cb2_p2 = (((unsigned int)pixel1_r4 >> 10) & 0x3ff);
-                    unsigned int cr2_p2 = (((unsigned int)pixel2_r4) & 0x3ff);
-                    unsigned int cb2_p1 = (cb2_p0 + cb2_p2) / 2;
-                    unsigned int cr2_p1 = (cr2_p0 + cr2_p2) / 2;
-                    lm4                 = (((unsigned int)pixel1_r4) & 0x3ff);
-
-                    const unsigned int pixel1_r5 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 6, y_pixel_src + 1, src_pitch);
-                    lm5 = (((unsigned int)pixel1_r5) & 0x3ff);
-
-                    dst_pixel0 = cb0_p1 | lm0 << 10 | cr0_p1 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p1 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p1 | lm3 << 10 | cb2_p1 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p1 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 2
-                    lm0 = (((unsigned int)pixel1_r0 >> 20) & 0x3ff);
-                    lm1 = (((unsigned int)pixel1_r1 >> 20) & 0x3ff);
-                    lm2 = (((unsigned int)pixel1_r2 >> 20) & 0x3ff);
-                    lm3 = (((unsigned int)pixel1_r3 >> 20) & 0x3ff);
-                    lm4 = (((unsigned int)pixel1_r4 >> 20) & 0x3ff);
-                    lm5 = (((unsigned int)pixel1_r5 >> 20) & 0x3ff);
-
-                    dst_pixel0 = cb0_p2 | lm0 << 10 | cr0_p2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p2 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p2 | lm3 << 10 | cb2_p2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p2 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 3
-                    const unsigned int pixel3_r0 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 1, y_pixel_src + 3, src_pitch);
-                    lm0                 = (((unsigned int)pixel2_r0 >> 10) & 0x3ff);
-                    unsigned int cb0_p4 = (((unsigned int)pixel2_r0 >> 20) & 0x3ff);
-                    unsigned int cr0_p4 = (((unsigned int)pixel3_r0 >> 10) & 0x3ff);
-                    unsigned int cb0_p3 = (cb0_p2 + cb0_p4) / 2;
-                    unsigned int cr0_p3 = (cr0_p2 + cr0_p4) / 2;
-
-                    const unsigned int pixel2_r1 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 2, y_pixel_src + 2, src_pitch);
-                    lm1 = (((unsigned int)pixel2_r1 >> 10) & 0x3ff);
-
-                    const unsigned int pixel3_r2 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 3, y_pixel_src + 3, src_pitch);
-                    lm2                 = (((unsigned int)pixel2_r2 >> 10) & 0x3ff);
-                    unsigned int cb1_p4 = (((unsigned int)pixel2_r2 >> 20) & 0x3ff);
-                    unsigned int cr1_p4 = (((unsigned int)pixel3_r2 >> 10) & 0x3ff);
-                    unsigned int cb1_p3 = (cb1_p2 + cb1_p4) / 2;
-                    unsigned int cr1_p3 = (cr1_p2 + cr1_p4) / 2;
-
-                    const unsigned int pixel2_r3 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 4, y_pixel_src + 2, src_pitch);
-                    lm3 = (((unsigned int)pixel2_r3 >> 10) & 0x3ff);
-
-                    const unsigned int pixel3_r4 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 5, y_pixel_src + 3, src_pitch);
-                    lm4                 = (((unsigned int)pixel2_r4 >> 10) & 0x3ff);
-                    unsigned int cb2_p4 = (((unsigned int)pixel2_r4 >> 20) & 0x3ff);
-                    unsigned int cr2_p4 = (((unsigned int)pixel3_r4 >> 10) & 0x3ff);
-                    // unsigned int cb2_p3 = (cb2_p2 + cb2_p4) / 2;
-                    // unsigned int cr2_p3 = (cr2_p2 + cr2_p4) / 2;
-
-                    const unsigned int pixel2_r5 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 6, y_pixel_src + 2, src_pitch);
-                    lm5 = (((unsigned int)pixel2_r5 >> 10) & 0x3ff);
-
-                    dst_pixel0 = cb0_p3 | lm0 << 10 | cr0_p3 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p3 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p3 | lm3 << 10 | cb2_p4 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p4 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 4
-                    lm0 = (((unsigned int)pixel3_r0) & 0x3ff);
-                    const unsigned int pixel3_r1 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 2, y_pixel_src + 3, src_pitch);
-                    lm1 = (((unsigned int)pixel3_r1) & 0x3ff);
-                    lm2 = (((unsigned int)pixel3_r2) & 0x3ff);
-                    const unsigned int pixel3_r3 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 4, y_pixel_src + 3, src_pitch);
-                    lm3 = (((unsigned int)pixel3_r3) & 0x3ff);
-                    lm4 = (((unsigned int)pixel3_r4) & 0x3ff);
-                    const unsigned int pixel3_r5 =
-                        src_read_int(buf_in, src_height - x_pixel_src - 6, y_pixel_src + 3, src_pitch);
-                    lm5 = (((unsigned int)pixel3_r5) & 0x3ff);
-
-                    dst_pixel0 = cb0_p4 | lm0 << 10 | cr0_p4 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p4 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p4 | lm3 << 10 | cb2_p4 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p4 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 5
-                    lm0 = (((unsigned int)pixel3_r0 >> 20) & 0x3ff);
-                    lm1 = (((unsigned int)pixel3_r1 >> 20) & 0x3ff);
-                    lm2 = (((unsigned int)pixel3_r2 >> 20) & 0x3ff);
-                    lm3 = (((unsigned int)pixel3_r3 >> 20) & 0x3ff);
-                    lm4 = (((unsigned int)pixel3_r4 >> 20) & 0x3ff);
-                    lm5 = (((unsigned int)pixel3_r5 >> 20) & 0x3ff);
-
-                    unsigned int cb0_p5 = (((unsigned int)pixel2_r0 >> 20) & 0x3ff);
-                    unsigned int cr0_p5 = (((unsigned int)pixel3_r0 >> 10) & 0x3ff);
-
-                    unsigned int cb1_p5 = (((unsigned int)pixel2_r2 >> 20) & 0x3ff);
-                    unsigned int cr1_p5 = (((unsigned int)pixel3_r2 >> 10) & 0x3ff);
-
-                    unsigned int cb2_p5 = (((unsigned int)pixel2_r4 >> 20) & 0x3ff);
-                    unsigned int cr2_p5 = (((unsigned int)pixel3_r4 >> 10) & 0x3ff);
-
-                    if ((int)idx[0] != dst_height / 6 - 1) {
-                        unsigned int pixel_r0_next =
-                            src_read_int(buf_in, src_height - x_pixel_src - 1, y_pixel_src + 4, src_pitch);
-                        unsigned int cb0_p0_next = (((unsigned int)pixel_r0_next) & 0x3ff);
-                        unsigned int cr0_p0_next = (((unsigned int)pixel_r0_next >> 20) & 0x3ff);
-                        cb0_p5                   = (cb0_p4 + cb0_p0_next) / 2;
-                        cr0_p5                   = (cr0_p4 + cr0_p0_next) / 2;
-
-                        unsigned int pixel_r2_next =
-                            src_read_int(buf_in, src_height - x_pixel_src - 3, y_pixel_src + 4, src_pitch);
-                        unsigned int cb1_p0_next = (((unsigned int)pixel_r2_next) & 0x3ff);
-                        unsigned int cr1_p0_next = (((unsigned int)pixel_r2_next >> 20) & 0x3ff);
-                        cb1_p5                   = (cb1_p4 + cb1_p0_next) / 2;
-                        cr1_p5                   = (cr1_p4 + cr1_p0_next) / 2;
-
-                        unsigned int pixel_r4_next =
-                            src_read_int(buf_in, src_height - x_pixel_src - 5, y_pixel_src + 4, src_pitch);
-                        unsigned int cb2_p0_next = (((unsigned int)pixel_r4_next) & 0x3ff);
-                        unsigned int cr2_p0_next = (((unsigned int)pixel_r4_next >> 20) & 0x3ff);
-                        cb2_p5                   = (cb2_p4 + cb2_p0_next) / 2;
-                        cr2_p5                   = (cr2_p4 + cr2_p0_next) / 2;
-                    }
-
-                    dst_pixel0 = cb0_p5 | lm0 << 10 | cr0_p5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p5 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p5 | lm3 << 10 | cb2_p5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p5 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    if ((int)idx[1] == (dst_width / 6 - 1)) {
-                        for (int y = 0; y < dst_height; y++) {
-                            for (int x = dst_width / 6; x < dst_pitch / 6; x++) {
-                                int dst_pitch          = (dst_width + 47) / 48 * 48;
-                                const auto x_pixel_dst = x * 4;
-
-                                unsigned int pixel3 =
-                                    src_read_int(buf_out, y, dst_width * 2 / 3 - 1, dst_pitch * 2 / 3);
-                                unsigned int pixel2 =
-                                    src_read_int(buf_out, y, dst_width * 2 / 3 - 2, dst_pitch * 2 / 3);
-                                unsigned int y5  = (((unsigned int)pixel3 >> 20) & 0x3ff);
-                                unsigned int cr2 = (((unsigned int)pixel3 >> 10) & 0x3ff);
-                                unsigned int cb2 = (((unsigned int)pixel2 >> 20) & 0x3ff);
-
-                                unsigned int dst_pixel0 = cb2 | y5 << 10 | cr2 << 20;
-                                dst_write_int(buf_out, y, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                                unsigned int dst_pixel1 = y5 | cb2 << 10 | y5 << 20;
-                                dst_write_int(buf_out, y, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                                unsigned int dst_pixel2 = cr2 | y5 << 10 | cb2 << 20;
-                                dst_write_int(buf_out, y, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                                unsigned int dst_pixel3 = y5 | cr2 << 10 | y5 << 20;
-                                dst_write_int(buf_out, y, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-                            }
-                        }
-                    }
-                });
             } else if (angle == 180) {
                 h.parallel_for(sycl::range<1>(dst_height * dst_width / 6), [=](sycl::id<1> idx) {
                     const unsigned int pixel3 = *(buf_in + dst_height * dst_width * 2 / 3 - idx[0] * 4 - 1);
@@ -474,271 +197,86 @@ IMPL_STATUS rotation_v210(struct impl_rotation_params *prt, unsigned char *buf_i
                     unsigned int dst_pixel3     = lm1 | cr0 << 10 | lm0 << 20;
                     *(buf_out + idx[0] * 4 + 3) = dst_pixel3;
                 });
-            } else if (angle == 270) {
-                int dst_pitch = (dst_width + 47) / 48 * 48;
-                int src_pitch = src_width * 2 / 3;
-
-                h.parallel_for(sycl::range<2>(dst_height / 6, dst_width / 6), [=](sycl::id<2> idx) {
-                    const auto y_pixel_dst = idx[0] * 6;
-                    const auto y_pixel_src = idx[0] * 4;
-                    const auto x_pixel_dst = idx[1] * 4;
-                    const auto x_pixel_src = idx[1] * 6;
-
-                    // pixel 0
-                    const unsigned int pixel3_r0 =
-                        src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 1, src_pitch);
-                    const unsigned int pixel2_r0 =
-                        src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 2, src_pitch);
-
-                    unsigned int lm0 = (((unsigned int)pixel3_r0 >> 20) & 0x3ff);
-
-                    unsigned int cb0_p0 = (((unsigned int)pixel2_r0 >> 20) & 0x3ff);
-                    unsigned int cr0_p0 = (((unsigned int)pixel3_r0 >> 10) & 0x3ff);
-
-                    const unsigned int pixel3_r1 =
-                        src_read_int(buf_in, x_pixel_src + 1, src_pitch - y_pixel_src - 1, src_pitch);
-                    unsigned int lm1 = (((unsigned int)pixel3_r1 >> 20) & 0x3ff);
-
-                    const unsigned int pixel3_r2 =
-                        src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 1, src_pitch);
-                    const unsigned int pixel2_r2 =
-                        src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 2, src_pitch);
-                    unsigned int lm2 = (((unsigned int)pixel3_r2 >> 20) & 0x3ff);
-
-                    unsigned int cb1_p0 = (((unsigned int)pixel2_r2 >> 20) & 0x3ff);
-                    unsigned int cr1_p0 = (((unsigned int)pixel3_r2 >> 10) & 0x3ff);
-
-                    unsigned int lm3 = (((unsigned int)pixel3_r2 >> 20) & 0x3ff);
-
-                    const unsigned int pixel3_r3 =
-                        src_read_int(buf_in, x_pixel_src + 3, src_pitch - y_pixel_src - 1, src_pitch);
-
-                    const unsigned int pixel3_r4 =
-                        src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 1, src_pitch);
-                    const unsigned int pixel2_r4 =
-                        src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 2, src_pitch);
-                    unsigned int lm4 = (((unsigned int)pixel3_r4 >> 20) & 0x3ff);
-
-                    unsigned int cb2_p0 = (((unsigned int)pixel2_r4 >> 20) & 0x3ff);
-                    unsigned int cr2_p0 = (((unsigned int)pixel3_r4 >> 10) & 0x3ff);
-
-                    const unsigned int pixel3_r5 =
-                        src_read_int(buf_in, x_pixel_src + 5, src_pitch - y_pixel_src - 1, src_pitch);
-                    unsigned int lm5 = (((unsigned int)pixel3_r5 >> 20) & 0x3ff);
-
-                    unsigned int dst_pixel0 = cb0_p0 | lm0 << 10 | cr0_p0 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    unsigned int dst_pixel1 = lm1 | cb1_p0 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    unsigned int dst_pixel2 = cr1_p0 | lm3 << 10 | cb2_p0 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    unsigned int dst_pixel3 = lm4 | cr2_p0 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 1
-                    lm0 = (((unsigned int)pixel3_r0) & 0x3ff);
-
-                    const unsigned int pixel1_r0 =
-                        src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 3, src_pitch);
-                    unsigned int cb0_p2 = (((unsigned int)pixel1_r0 >> 10) & 0x3ff);
-                    unsigned int cr0_p2 = (((unsigned int)pixel2_r0) & 0x3ff);
-                    unsigned int cb0_p1 = (cb0_p0 + cb0_p2) / 2;
-                    unsigned int cr0_p1 = (cr0_p0 + cr0_p2) / 2;
-
-                    lm1 = (((unsigned int)pixel3_r1) & 0x3ff);
-
-                    lm2 = (((unsigned int)pixel3_r2) & 0x3ff);
-
-                    const unsigned int pixel1_r2 =
-                        src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 3, src_pitch);
-                    unsigned int cb1_p2 = (((unsigned int)pixel1_r2 >> 10) & 0x3ff);
-                    unsigned int cr1_p2 = (((unsigned int)pixel2_r2) & 0x3ff);
-                    unsigned int cb1_p1 = (cb1_p0 + cb1_p2) / 2;
-                    unsigned int cr1_p1 = (cr1_p0 + cr1_p2) / 2;
-
-                    lm3 = (((unsigned int)pixel3_r3) & 0x3ff);
-
-                    lm4 = (((unsigned int)pixel3_r4) & 0x3ff);
-                    const unsigned int pixel1_r4 =
-                        src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 3, src_pitch);
-                    unsigned int cb2_p2 = (((unsigned int)pixel1_r4 >> 10) & 0x3ff);
-                    unsigned int cr2_p2 = (((unsigned int)pixel2_r4) & 0x3ff);
-                    unsigned int cb2_p1 = (cb2_p0 + cb2_p2) / 2;
-                    unsigned int cr2_p1 = (cr2_p0 + cr2_p2) / 2;
-
-                    lm5 = (((unsigned int)pixel3_r5) & 0x3ff);
-
-                    dst_pixel0 = cb0_p1 | lm0 << 10 | cr0_p1 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p1 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p1 | lm3 << 10 | cb2_p1 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p1 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 1, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 2
-                    lm0 = (((unsigned int)pixel2_r0 >> 10) & 0x3ff);
-                    const unsigned int pixel2_r1 =
-                        src_read_int(buf_in, x_pixel_src + 1, src_pitch - y_pixel_src - 2, src_pitch);
-                    lm1 = (((unsigned int)pixel2_r1 >> 10) & 0x3ff);
-                    lm2 = (((unsigned int)pixel2_r2 >> 10) & 0x3ff);
-                    const unsigned int pixel2_r3 =
-                        src_read_int(buf_in, x_pixel_src + 3, src_pitch - y_pixel_src - 2, src_pitch);
-                    lm3 = (((unsigned int)pixel2_r3 >> 10) & 0x3ff);
-                    lm4 = (((unsigned int)pixel2_r4 >> 10) & 0x3ff);
-                    const unsigned int pixel2_r5 =
-                        src_read_int(buf_in, x_pixel_src + 5, src_pitch - y_pixel_src - 2, src_pitch);
-                    lm5 = (((unsigned int)pixel2_r5 >> 10) & 0x3ff);
-
-                    dst_pixel0 = cb0_p2 | lm0 << 10 | cr0_p2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p2 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p2 | lm3 << 10 | cb2_p2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p2 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 2, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 3
-                    const unsigned int pixel0_r0 =
-                        src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm0                 = (((unsigned int)pixel1_r0 >> 20) & 0x3ff);
-                    unsigned int cb0_p4 = (((unsigned int)pixel0_r0) & 0x3ff);
-                    unsigned int cr0_p4 = (((unsigned int)pixel0_r0 >> 20) & 0x3ff);
-                    unsigned int cb0_p3 = (cb0_p2 + cb0_p4) / 2;
-                    unsigned int cr0_p3 = (cr0_p2 + cr0_p4) / 2;
-                    const unsigned int pixel1_r1 =
-                        src_read_int(buf_in, x_pixel_src + 1, src_pitch - y_pixel_src - 3, src_pitch);
-                    lm1 = (((unsigned int)pixel1_r1 >> 20) & 0x3ff);
-                    const unsigned int pixel0_r2 =
-                        src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm2                 = (((unsigned int)pixel1_r2 >> 20) & 0x3ff);
-                    unsigned int cb1_p4 = (((unsigned int)pixel0_r2) & 0x3ff);
-                    unsigned int cr1_p4 = (((unsigned int)pixel0_r2 >> 20) & 0x3ff);
-                    unsigned int cb1_p3 = (cb1_p2 + cb1_p4) / 2;
-                    unsigned int cr1_p3 = (cr1_p2 + cr1_p4) / 2;
-                    const unsigned int pixel1_r3 =
-                        src_read_int(buf_in, x_pixel_src + 3, src_pitch - y_pixel_src - 3, src_pitch);
-                    lm3 = (((unsigned int)pixel1_r3 >> 20) & 0x3ff);
-                    const unsigned int pixel0_r4 =
-                        src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm4                 = (((unsigned int)pixel1_r4 >> 20) & 0x3ff);
-                    unsigned int cb2_p4 = (((unsigned int)pixel0_r4) & 0x3ff);
-                    unsigned int cr2_p4 = (((unsigned int)pixel0_r4 >> 20) & 0x3ff);
-                    unsigned int cb2_p3 = (cb2_p2 + cb2_p4) / 2;
-                    unsigned int cr2_p3 = (cr2_p2 + cr2_p4) / 2;
-
-                    const unsigned int pixel1_r5 =
-                        src_read_int(buf_in, x_pixel_src + 5, src_pitch - y_pixel_src - 3, src_pitch);
-                    lm5 = (((unsigned int)pixel1_r5 >> 20) & 0x3ff);
-
-                    dst_pixel0 = cb0_p3 | lm0 << 10 | cr0_p3 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p3 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p3 | lm3 << 10 | cb2_p3 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p3 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 3, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 4
-                    lm0 = (((unsigned int)pixel1_r0) & 0x3ff);
-                    lm1 = (((unsigned int)pixel1_r1) & 0x3ff);
-                    lm2 = (((unsigned int)pixel1_r2) & 0x3ff);
-                    lm3 = (((unsigned int)pixel1_r3) & 0x3ff);
-                    lm4 = (((unsigned int)pixel1_r4) & 0x3ff);
-                    lm5 = (((unsigned int)pixel1_r5) & 0x3ff);
-
-                    dst_pixel0 = cb0_p4 | lm0 << 10 | cr0_p4 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p4 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p4 | lm3 << 10 | cb2_p4 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p4 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 4, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    // pixel 5
-                    lm0 = (((unsigned int)pixel0_r0 >> 10) & 0x3ff);
-                    const unsigned int pixel0_r1 =
-                        src_read_int(buf_in, x_pixel_src + 1, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm1 = (((unsigned int)pixel0_r1 >> 10) & 0x3ff);
-                    lm2 = (((unsigned int)pixel0_r2 >> 10) & 0x3ff);
-                    const unsigned int pixel0_r3 =
-                        src_read_int(buf_in, x_pixel_src + 3, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm3 = (((unsigned int)pixel0_r3 >> 10) & 0x3ff);
-                    lm4 = (((unsigned int)pixel0_r4 >> 10) & 0x3ff);
-                    const unsigned int pixel0_r5 =
-                        src_read_int(buf_in, x_pixel_src + 5, src_pitch - y_pixel_src - 4, src_pitch);
-                    lm5 = (((unsigned int)pixel0_r5 >> 10) & 0x3ff);
-
-                    unsigned int cb0_p5 = cb0_p4;
-                    unsigned int cr0_p5 = cr0_p4;
-
-                    unsigned int cb1_p5 = cb1_p4;
-                    unsigned int cr1_p5 = cr1_p4;
-
-                    unsigned int cb2_p5 = cb2_p4;
-                    unsigned int cr2_p5 = cr2_p4;
-
-                    if ((int)idx[0] != dst_height / 6 - 1) {
-                        unsigned int pixel3_r0_next =
-                            src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 5, src_pitch);
-                        unsigned int pixel2_r0_next =
-                            src_read_int(buf_in, x_pixel_src, src_pitch - y_pixel_src - 6, src_pitch);
-                        unsigned int cb0_p0_next = (((unsigned int)pixel2_r0_next >> 20) & 0x3ff);
-                        unsigned int cr0_p0_next = (((unsigned int)pixel3_r0_next >> 10) & 0x3ff);
-                        cb0_p5                   = (cb0_p4 + cb0_p0_next) / 2;
-                        cr0_p5                   = (cr0_p4 + cr0_p0_next) / 2;
-
-                        unsigned int pixel3_r2_next =
-                            src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 5, src_pitch);
-                        unsigned int pixel2_r2_next =
-                            src_read_int(buf_in, x_pixel_src + 2, src_pitch - y_pixel_src - 6, src_pitch);
-                        unsigned int cb1_p0_next = (((unsigned int)pixel2_r2_next >> 20) & 0x3ff);
-                        unsigned int cr1_p0_next = (((unsigned int)pixel3_r2_next >> 10) & 0x3ff);
-                        cb1_p5                   = (cb1_p4 + cb1_p0_next) / 2;
-                        cr1_p5                   = (cr1_p4 + cr1_p0_next) / 2;
-
-                        unsigned int pixel3_r4_next =
-                            src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 5, src_pitch);
-                        unsigned int pixel2_r4_next =
-                            src_read_int(buf_in, x_pixel_src + 4, src_pitch - y_pixel_src - 6, src_pitch);
-                        unsigned int cb2_p0_next = (((unsigned int)pixel2_r4_next >> 20) & 0x3ff);
-                        unsigned int cr2_p0_next = (((unsigned int)pixel3_r4_next >> 10) & 0x3ff);
-                        cb2_p5                   = (cb2_p4 + cb2_p0_next) / 2;
-                        cr2_p5                   = (cr2_p4 + cr2_p0_next) / 2;
+            } else {
+                // 90 and 270 transpose RT_V210_TILE x RT_V210_TILE tiles through local memory. Tiles are laid
+                // out on the destination, its rows are source columns. A destination pixel pair takes the
+                // chroma of its first pixel's source row, odd destination rows average the chroma of the
+                // pairs before and after, so every tile also loads the chroma pair past its last row
+                const bool clockwise = angle == 90;
+                const int dst_pitch  = (dst_width + 47) / 48 * 48;
+                const int src_pitch  = src_width * 2 / 3;
+                const int dst_cols   = dst_width / 6 * 6;
+                const int tiles_x    = (dst_cols + RT_V210_TILE - 1) / RT_V210_TILE;
+                const int tiles_y    = (dst_height + RT_V210_TILE - 1) / RT_V210_TILE;
+                constexpr int lm_pitch = RT_V210_TILE + 1;
+                constexpr int c_pitch  = RT_V210_TILE / 2 + 1;
+                constexpr int threads  = RT_V210_ROWS * RT_V210_COLS;
+                sycl::local_accessor<unsigned short, 1> lm_tile(sycl::range<1>(RT_V210_TILE * lm_pitch), h);
+                sycl::local_accessor<unsigned short, 1> cb_tile(sycl::range<1>(RT_V210_TILE * c_pitch), h);
+                sycl::local_accessor<unsigned short, 1> cr_tile(sycl::range<1>(RT_V210_TILE * c_pitch), h);
+                sycl::range<2> global(tiles_y * RT_V210_ROWS, tiles_x * RT_V210_COLS);
+                h.parallel_for(sycl::nd_range<2>(global, sycl::range<2>(RT_V210_ROWS, RT_V210_COLS)),
+                               [=](sycl::nd_item<2> item) {
+                    const int dy0 = item.get_group(0) * RT_V210_TILE;
+                    const int dx0 = item.get_group(1) * RT_V210_TILE;
+                    const int lid = item.get_local_linear_id();
+                    // source rows of the tile, its source columns are the destination rows
+                    const int sy0 = clockwise ? src_height - dx0 - RT_V210_TILE : dx0;
+                    const int sx0 = clockwise ? dy0 : src_width - dy0 - RT_V210_TILE;
+                    // tile row r of the destination column x
+                    auto row = [&](int x) { return clockwise ? RT_V210_TILE - 1 - x : x; };
+
+                    for (int i = lid; i < RT_V210_TILE * RT_V210_TILE; i += threads) {
+                        const int r  = i / RT_V210_TILE;
+                        const int c  = i % RT_V210_TILE;
+                        const int sy = sy0 + r;
+                        const int sx = sx0 + c;
+                        if (sy >= 0 && sy < src_height && sx >= 0 && sx < src_width)
+                            lm_tile[r * lm_pitch + (clockwise ? c : RT_V210_TILE - 1 - c)] =
+                                read_v210_lm(buf_in, sy, sx, src_pitch);
                     }
-
-                    dst_pixel0 = cb0_p5 | lm0 << 10 | cr0_p5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                    dst_pixel1 = lm1 | cb1_p5 << 10 | lm2 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                    dst_pixel2 = cr1_p5 | lm3 << 10 | cb2_p5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                    dst_pixel3 = lm4 | cr2_p5 << 10 | lm5 << 20;
-                    dst_write_int(buf_out, y_pixel_dst + 5, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
-
-                    for (int y = 0; y < dst_height; y++) {
-                        int dst_pitch = (dst_width + 47) / 48 * 48;
-                        for (int x = dst_width / 6; x < dst_pitch / 6; x++) {
-                            const auto x_pixel_dst = x * 4;
-
-                            unsigned int pixel3 = src_read_int(buf_out, y, dst_width * 2 / 3 - 1, dst_pitch * 2 / 3);
-                            unsigned int pixel2 = src_read_int(buf_out, y, dst_width * 2 / 3 - 2, dst_pitch * 2 / 3);
-                            unsigned int y5     = (((unsigned int)pixel3 >> 20) & 0x3ff);
-                            unsigned int cr2    = (((unsigned int)pixel3 >> 10) & 0x3ff);
-                            unsigned int cb2    = (((unsigned int)pixel2 >> 20) & 0x3ff);
-
-                            unsigned int dst_pixel0 = cb2 | y5 << 10 | cr2 << 20;
-                            dst_write_int(buf_out, y, x_pixel_dst, dst_pitch * 2 / 3, dst_pixel0);
-                            unsigned int dst_pixel1 = y5 | cb2 << 10 | y5 << 20;
-                            dst_write_int(buf_out, y, x_pixel_dst + 1, dst_pitch * 2 / 3, dst_pixel1);
-                            unsigned int dst_pixel2 = cr2 | y5 << 10 | cb2 << 20;
-                            dst_write_int(buf_out, y, x_pixel_dst + 2, dst_pitch * 2 / 3, dst_pixel2);
-                            unsigned int dst_pixel3 = y5 | cr2 << 10 | y5 << 20;
-                            dst_write_int(buf_out, y, x_pixel_dst + 3, dst_pitch * 2 / 3, dst_pixel3);
+                    for (int i = lid; i < RT_V210_TILE * c_pitch; i += threads) {
+                        const int r  = i / c_pitch;
+                        const int k  = i % c_pitch;
+                        const int sy = sy0 + r;
+                        const int kp = dy0 / 2 + k;
+                        if (sy >= 0 && sy < src_height && kp < dst_height / 2) {
+                            const int pair          = clockwise ? kp : src_width / 2 - 1 - kp;
+                            cb_tile[r * c_pitch + k] = read_v210_cb(buf_in, sy, pair, src_pitch);
+                            cr_tile[r * c_pitch + k] = read_v210_cr(buf_in, sy, pair, src_pitch);
+                        }
+                    }
+                    sycl::group_barrier(item.get_group());
+
+                    for (int i = lid; i < RT_V210_TILE * (RT_V210_TILE / 6); i += threads) {
+                        const int r = i / (RT_V210_TILE / 6);
+                        const int g = i % (RT_V210_TILE / 6) * 6;
+                        const int y = dy0 + r;
+                        const int x = dx0 + g;
+                        if (y >= dst_height || x >= dst_cols)
+                            continue;
+                        const int k      = r / 2;
+                        const bool blend = (y % 2) != 0 && y / 2 + 1 < dst_height / 2;
+                        float lm[6], cb[3], cr[3];
+#pragma unroll
+                        for (int j = 0; j < 6; j++)
+                            lm[j] = lm_tile[row(g + j) * lm_pitch + r];
+#pragma unroll
+                        for (int j = 0; j < 3; j++) {
+                            const int c = row(g + j * 2) * c_pitch + k;
+                            cb[j]       = blend ? (cb_tile[c] + cb_tile[c + 1]) / 2 : cb_tile[c];
+                            cr[j]       = blend ? (cr_tile[c] + cr_tile[c + 1]) / 2 : cr_tile[c];
+                        }
+                        rs_format<IMPL_VIDEO_V210>::write(buf_out_c, dst_pitch, dst_height, x, y, 0, 0, lm, cb, cr,
+                                                          true);
+                        // the row is padded to 48 pixels with its last pixel
+                        if (x + 6 == dst_cols) {
+                            float pad_lm[6] = {lm[5], lm[5], lm[5], lm[5], lm[5], lm[5]};
+                            float pad_cb[3] = {cb[2], cb[2], cb[2]};
+                            float pad_cr[3] = {cr[2], cr[2], cr[2]};
+                            for (int px = dst_cols; px < dst_pitch; px += 6)
+                                rs_format<IMPL_VIDEO_V210>::write(buf_out_c, dst_pitch, dst_height, px, y, 0, 0,
+                                                                  pad_lm, pad_cb, pad_cr, true);
                         }
                     }
                 });
@@ -748,17 +286,240 @@ IMPL_STATUS rotation_v210(struct impl_rotation_params *prt, unsigned char *buf_i
             ret = IMPL_STATUS_FAIL;
         }
     });
-    *(sycl::event *)prt->evt = event;
-    if (prt->is_async == 0) {
-        event.wait();
+    impl_common_run_done(q, prt->evt, event, prt->is_async);
+    return ret;
+}
+
+/* source column sx and row sy of the destination pixel (x, y) of a rotated and mirrored w x h plane */
+static inline void rotation_map(int angle, int flip, uint32_t w, uint32_t h, uint32_t x, uint32_t y, uint32_t &sx,
+                                uint32_t &sy) {
+    const bool swap = angle == 90 || angle == 270;
+    if (flip == IMPL_FLIP_HORIZONTAL)
+        x = (swap ? h : w) - 1 - x;
+    else if (flip == IMPL_FLIP_VERTICAL)
+        y = (swap ? w : h) - 1 - y;
+    switch (angle) {
+    case 90:
+        sx = y;
+        sy = h - 1 - x;
+        break;
+    case 180:
+        sx = w - 1 - x;
+        sy = h - 1 - y;
+        break;
+    case 270:
+        sx = w - 1 - y;
+        sy = x;
+        break;
+    default:
+        sx = x;
+        sy = y;
+        break;
+    }
+}
+
+template <impl_video_format FORMAT>
+IMPL_STATUS rotation_generic(struct impl_rotation_params *prt, unsigned char *buf_in, unsigned char *buf_out,
+                             void *dep_evt) {
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int group_width = fmt::group_width;
+    constexpr int cshift      = fmt::is_420 ? 1 : 0;
+    queue q                   = *(queue *)(prt->pq);
+    const uint32_t src_width  = prt->src_width;
+    const uint32_t src_height = prt->src_height;
+    const uint32_t dst_width  = prt->dst_width;
+    const uint32_t dst_height = prt->dst_height;
+    const int angle           = prt->angle;
+    const int flip            = prt->flip;
+    const bool swap           = angle == 90 || angle == 270;
+    const uint32_t dst_pitch  = FORMAT == IMPL_VIDEO_V210 ? (dst_width + 47) / 48 * 48 : dst_width;
+    const uint32_t dst_cols   = dst_width / group_width * group_width;
+
+    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
+
+    auto event = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            // every work-item writes one pixel group of the destination from the source pixels it maps to.
+            // 4:2:0 chroma and 0/180 4:2:2 chroma map plane to plane like luma. 90/270 turns 4:2:2 into 4:4:0,
+            // so like the v210 tiled kernel a pixel pair takes the chroma of its first pixel's source row and
+            // odd destination rows average the chroma of the pairs before and after
+            h.parallel_for(sycl::range<2>(dst_height, dst_cols / group_width), [=](sycl::id<2> idx) {
+                const uint32_t y  = idx[0];
+                const uint32_t x  = idx[1] * group_width;
+                const bool chroma = !fmt::is_420 || (y % 2) == 0;
+                const bool blend  = (y % 2) != 0 && y / 2 + 1 < dst_height / 2;
+                float lm[group_width], cb[group_width / 2], cr[group_width / 2];
+                uint32_t sx, sy;
+#pragma unroll
+                for (int j = 0; j < group_width; j++) {
+                    rotation_map(angle, flip, src_width, src_height, x + j, y, sx, sy);
+                    lm[j] = fmt::read_lm(buf_in, src_width, src_height, sy, sx);
+                }
+                if (chroma) {
+#pragma unroll
+                    for (int j = 0; j < group_width / 2; j++) {
+                        if (!fmt::is_420 && swap) {
+                            uint32_t pa, pb;
+                            rotation_map(angle, flip, src_width, src_height, x + j * 2, y & ~1u, pa, sy);
+                            pa /= 2;
+                            pb = pa;
+                            if (blend) {
+                                rotation_map(angle, flip, src_width, src_height, x + j * 2, y + 1, pb, sy);
+                                pb /= 2;
+                            }
+                            cb[j] = (fmt::read_cb(buf_in, src_width, src_height, sy, pa) +
+                                     fmt::read_cb(buf_in, src_width, src_height, sy, pb)) / 2;
+                            cr[j] = (fmt::read_cr(buf_in, src_width, src_height, sy, pa) +
+                                     fmt::read_cr(buf_in, src_width, src_height, sy, pb)) / 2;
+                        } else {
+                            rotation_map(angle, flip, src_width / 2, src_height >> cshift, x / 2 + j, y >> cshift,
+                                         sx, sy);
+                            cb[j] = fmt::read_cb(buf_in, src_width, src_height, sy, sx);
+                            cr[j] = fmt::read_cr(buf_in, src_width, src_height, sy, sx);
+                        }
+                    }
+                }
+                fmt::write(buf_out, dst_pitch, dst_height, x, y, 0, 0, lm, cb, cr, chroma);
+                if constexpr (FORMAT == IMPL_VIDEO_V210) {
+                    // the row is padded to 48 pixels with its last pixel
+                    if (x + group_width == dst_cols) {
+                        float pad_lm[6] = {lm[5], lm[5], lm[5], lm[5], lm[5], lm[5]};
+                        float pad_cb[3] = {cb[2], cb[2], cb[2]};
+                        float pad_cr[3] = {cr[2], cr[2], cr[2]};
+                        for (uint32_t px = dst_cols; px < dst_pitch; px += 6)
+                            fmt::write(buf_out, dst_pitch, dst_height, px, y, 0, 0, pad_lm, pad_cb, pad_cr, true);
+                    }
+                }
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+    impl_common_run_done(q, prt->evt, event, prt->is_async);
+    return ret;
+}
+
+template <impl_video_format FORMAT>
+IMPL_STATUS rotation_in_place(struct impl_rotation_params *prt, unsigned char *buf_in, unsigned char *buf_out,
+                              void *dep_evt) {
+    (void)buf_out;
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int group_width = fmt::group_width;
+    constexpr int cshift      = fmt::is_420 ? 1 : 0;
+    constexpr int rows        = fmt::is_420 ? 2 : 1;
+    queue q                   = *(queue *)(prt->pq);
+    const uint32_t width      = prt->src_width;
+    const uint32_t height     = prt->src_height;
+
+    IMPL_STATUS ret = IMPL_STATUS_SUCCESS;
+
+    if (prt->angle == 0) {
+        // nothing to move, the frame is complete once its producer is, a barrier gives it an event on q
+        std::vector<sycl::event> deps;
+        if (dep_evt)
+            deps.push_back(*(sycl::event *)dep_evt);
+        try {
+            auto event = q.ext_oneapi_submit_barrier(deps);
+            impl_common_run_done(q, prt->evt, event, prt->is_async);
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+        return ret;
     }
+
+    auto event = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            // 180 swaps every block of rows x group_width pixels with its mirror, a 4:2:0 block is a row pair
+            // so it owns one chroma row. Blocks are numbered in raster order, block n pairs with total - 1 - n
+            // and the lower of the two does the swap, a middle block reverses itself
+            const uint32_t groups = width / group_width;
+            const uint32_t total  = height / rows * groups;
+            h.parallel_for(sycl::range<1>((total + 1) / 2), [=](sycl::id<1> idx) {
+                const uint32_t n[2] = {(uint32_t)idx[0], total - 1 - (uint32_t)idx[0]};
+                float lm[2][rows][group_width], cb[2][group_width / 2], cr[2][group_width / 2];
+#pragma unroll
+                for (int b = 0; b < 2; b++) {
+                    const uint32_t x = n[b] % groups * group_width;
+                    const uint32_t y = n[b] / groups * rows;
+#pragma unroll
+                    for (int r = 0; r < rows; r++)
+#pragma unroll
+                        for (int j = 0; j < group_width; j++)
+                            lm[b][r][j] = fmt::read_lm(buf_in, width, height, y + r, x + j);
+#pragma unroll
+                    for (int j = 0; j < group_width / 2; j++) {
+                        cb[b][j] = fmt::read_cb(buf_in, width, height, y >> cshift, x / 2 + j);
+                        cr[b][j] = fmt::read_cr(buf_in, width, height, y >> cshift, x / 2 + j);
+                    }
+                }
+#pragma unroll
+                for (int b = 0; b < 2; b++) {
+                    const uint32_t x = n[1 - b] % groups * group_width;
+                    const uint32_t y = n[1 - b] / groups * rows;
+                    float olm[group_width], ocb[group_width / 2], ocr[group_width / 2];
+#pragma unroll
+                    for (int j = 0; j < group_width / 2; j++) {
+                        ocb[j] = cb[b][group_width / 2 - 1 - j];
+                        ocr[j] = cr[b][group_width / 2 - 1 - j];
+                    }
+#pragma unroll
+                    for (int r = 0; r < rows; r++) {
+#pragma unroll
+                        for (int j = 0; j < group_width; j++)
+                            olm[j] = lm[b][rows - 1 - r][group_width - 1 - j];
+                        fmt::write(buf_in, width, height, x, y + r, 0, 0, olm, ocb, ocr, r == 0);
+                    }
+                }
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+    impl_common_run_done(q, prt->evt, event, prt->is_async);
     return ret;
 }
 
-enum RT_function_index { rotation_i420_index, rotation_v210_index, rotation_max_index };
+enum RT_function_index {
+    rotation_i420_index,
+    rotation_v210_index,
+    rotation_generic_index,
+    rotation_in_place_index,
+    rotation_max_index
+};
 typedef IMPL_STATUS (*Rt_Function)(struct impl_rotation_params *prt, unsigned char *buf_in, unsigned char *buf_out,
                                    void *dep_evt);
 Rt_Function rotationfunction[2] = {rotation_i420, rotation_v210};
+/* any format and mirror, indexed by impl_video_format */
+constexpr Rt_Function rotationgeneric[IMPL_VIDEO_MAX] = {rotation_generic<IMPL_VIDEO_I420>,
+                                                         rotation_generic<IMPL_VIDEO_V210>,
+                                                         rotation_generic<IMPL_VIDEO_Y210>,
+                                                         rotation_generic<IMPL_VIDEO_NV12>,
+                                                         rotation_generic<IMPL_VIDEO_P010>,
+                                                         rotation_generic<IMPL_VIDEO_YUV420P10LE>,
+                                                         rotation_generic<IMPL_VIDEO_YUV422P10LE>,
+                                                         rotation_generic<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                         rotation_generic<IMPL_VIDEO_YUV422YCBCR10LE>};
+/* angle 0 and 180 in buf_in, indexed by impl_video_format */
+constexpr Rt_Function rotationinplace[IMPL_VIDEO_MAX] = {rotation_in_place<IMPL_VIDEO_I420>,
+                                                         rotation_in_place<IMPL_VIDEO_V210>,
+                                                         rotation_in_place<IMPL_VIDEO_Y210>,
+                                                         rotation_in_place<IMPL_VIDEO_NV12>,
+                                                         rotation_in_place<IMPL_VIDEO_P010>,
+                                                         rotation_in_place<IMPL_VIDEO_YUV420P10LE>,
+                                                         rotation_in_place<IMPL_VIDEO_YUV422P10LE>,
+                                                         rotation_in_place<IMPL_VIDEO_YUV422YCBCR10BE>,
+                                                         rotation_in_place<IMPL_VIDEO_YUV422YCBCR10LE>};
 
 IMPL_STATUS impl_rotation_init(struct impl_rotation_params *prt, void *&prt_context) {
     IMPL_ASSERT(prt != NULL, "rotation init failed, prt is null");
@@ -768,29 +529,50 @@ IMPL_STATUS impl_rotation_init(struct impl_rotation_params *prt, void *&prt_cont
         return IMPL_STATUS_INVALID_PARAMS;
     }
 
-    prt->evt                        = impl_common_new_event();
-    impl_rotation_context *pcontext = new impl_rotation_context;
-    memset(pcontext, 0, sizeof(impl_rotation_context));
-    prt_context = (void *)pcontext;
-    if (IMPL_VIDEO_I420 == prt->format) {
-        pcontext->rotation_func_index = rotation_i420_index;
-    } else if (IMPL_VIDEO_V210 == prt->format) {
-        pcontext->rotation_func_index = rotation_v210_index;
-    } else {
-        err("%s, unsupported format, rotation only supports i420 and v210\n", __func__);
-        return IMPL_STATUS_FAIL;
+    if (prt->format < 0 || prt->format >= IMPL_VIDEO_MAX) {
+        err("%s, unsupported format %d\n", __func__, prt->format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (prt->flip < IMPL_FLIP_NONE || prt->flip >= IMPL_FLIP_MAX) {
+        err("%s, Illegal flip %d\n", __func__, prt->flip);
+        return IMPL_STATUS_INVALID_PARAMS;
     }
     if ((prt->src_width % 2) != 0 || (prt->src_height % 2) != 0 || (prt->dst_width % 2) != 0 ||
         (prt->dst_height % 2) != 0) {
         err("%s, Illegal size: The src/dstwidth and height must be a multiple of 2\n", __func__);
         return IMPL_STATUS_INVALID_PARAMS;
     }
+    if (prt->in_place && ((0 != prt->angle && 180 != prt->angle) || IMPL_FLIP_NONE != prt->flip)) {
+        err("%s, in place rotation only supports angle 0 and 180 without flip\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    const bool swap = 90 == prt->angle || 270 == prt->angle;
+    if (prt->dst_width != (swap ? prt->src_height : prt->src_width) ||
+        prt->dst_height != (swap ? prt->src_width : prt->src_height)) {
+        err("%s, Illegal size: dst %dx%d is not src %dx%d rotated by %d\n", __func__, prt->dst_width,
+            prt->dst_height, prt->src_width, prt->src_height, prt->angle);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
     if (IMPL_VIDEO_V210 == prt->format && (prt->src_width % 48) != 0 && (prt->dst_width % 48) != 0) {
         err("%s, Illegal V210 size: The src/width width=%d/%d must be a multiple of 48\n", __func__, prt->src_width,
             prt->dst_width);
         return IMPL_STATUS_INVALID_PARAMS;
     }
 
+    prt->evt                        = impl_common_new_event();
+    impl_rotation_context *pcontext = new impl_rotation_context;
+    memset(pcontext, 0, sizeof(impl_rotation_context));
+    prt_context = (void *)pcontext;
+    if (prt->in_place) {
+        pcontext->rotation_func_index = rotation_in_place_index;
+    } else if (IMPL_VIDEO_I420 == prt->format && IMPL_FLIP_NONE == prt->flip) {
+        pcontext->rotation_func_index = rotation_i420_index;
+    } else if (IMPL_VIDEO_V210 == prt->format && IMPL_FLIP_NONE == prt->flip) {
+        pcontext->rotation_func_index = rotation_v210_index;
+    } else {
+        pcontext->rotation_func_index = rotation_generic_index;
+    }
+
     return IMPL_STATUS_SUCCESS;
 }
 
@@ -801,11 +583,22 @@ IMPL_STATUS impl_rotation_run(struct impl_rotation_params *prt, void *prt_contex
 
     IMPL_STATUS ret                        = IMPL_STATUS_SUCCESS;
     struct impl_rotation_context *pcontext = (struct impl_rotation_context *)prt_context;
-    ret = rotationfunction[pcontext->rotation_func_index](prt, buf_in, buf_out, dep_evt);
+    if (rotation_in_place_index == pcontext->rotation_func_index)
+        ret = rotationinplace[prt->format](prt, buf_in, buf_out, dep_evt);
+    else if (rotation_generic_index == pcontext->rotation_func_index)
+        ret = rotationgeneric[prt->format](prt, buf_in, buf_out, dep_evt);
+    else
+        ret = rotationfunction[pcontext->rotation_func_index](prt, buf_in, buf_out, dep_evt);
 
     return ret;
 }
 
+IMPL_STATUS impl_rotation_run_evt(struct impl_rotation_params *prt, void *prt_context, unsigned char *buf_in,
+                                  unsigned char *buf_out, void *dep_evt, void *&evt) {
+    IMPL_ASSERT(prt != NULL, "rotation run failed, prt is null");
+    return impl_common_run_evt(prt, evt, impl_rotation_run, prt_context, buf_in, buf_out, dep_evt);
+}
+
 void impl_rotation_uninit(struct impl_rotation_params *prt, void *prt_context) {
     IMPL_ASSERT(prt != NULL, "rotation uninit failed, prt is null");
     IMPL_ASSERT(prt_context != NULL, "rotation uninit failed, prt_context is null");
@@ -6,6 +6,15 @@
 #define __IMPL_ROTATION_HPP__
 #include "impl_api.h"
 #include "impl_common.hpp"
+#include "impl_resize_format.hpp"
+
+/* 90/270 tile edge in samples and work-group rows, a work-group is RT_TILE_ROWS x RT_TILE */
+#define RT_TILE 32
+#define RT_TILE_ROWS 8
+/* v210 90/270 tile edge in pixels, a multiple of the 6 pixel group, and work-group size */
+#define RT_V210_TILE 48
+#define RT_V210_ROWS 8
+#define RT_V210_COLS 8
 
 struct impl_rotation_context {
     /** IMPL Rotation function index */
@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_sg.hpp"
+
+#include "impl_api.h"
+#include "impl_trace.hpp"
+
+IMPL_STATUS impl_sg_check(const struct impl_sg_input *pin, int width, int height) {
+    if (pin == NULL || pin->num_segments < 0 || (pin->num_segments > 0 && pin->segments == NULL)) {
+        err("%s, invalid scatter-gather input\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pin->fill < 0 || pin->fill >= IMPL_SG_FILL_MAX || (pin->fill == IMPL_SG_FILL_FRAME && pin->fill_frame == NULL)) {
+        err("%s, invalid fill policy %d\n", __func__, pin->fill);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if ((width % 2) != 0) {
+        err("%s, Illegal size: The width must be a multiple of 2\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    // the line index is a binary search over the lines, every segment stays inside its line
+    for (int i = 0; i < pin->num_segments; i++) {
+        const struct impl_sg_segment &seg = pin->segments[i];
+        if (seg.buf == NULL || seg.line < 0 || seg.line >= height || (i > 0 && seg.line < pin->segments[i - 1].line) ||
+            seg.offset < 0 || (seg.offset % 2) != 0 || seg.length < 0 || (seg.length % 5) != 0 ||
+            seg.offset + seg.length / 5 * 2 > width) {
+            err("%s, invalid segment %d: line %d, offset %d, length %d\n", __func__, i, seg.line, seg.offset,
+                seg.length);
+            return IMPL_STATUS_INVALID_PARAMS;
+        }
+    }
+    return IMPL_STATUS_SUCCESS;
+}
+
+/* waits for the last gather kernel reading the index buffer */
+static void sg_wait_gather(queue &q, struct sg_index &index) {
+    if (index.gather_evt != NULL)
+        ((event *)index.gather_evt)->wait();
+    else if (q.is_in_order())
+        q.wait(); // no gather event with discard_events
+}
+
+IMPL_STATUS impl_sg_index(void *pq, const struct impl_sg_input *pin, int width, int height, struct sg_index &index,
+                          struct sg_kernel_src &src, void *dep_evt, sycl::event &evt) {
+    queue q = *(queue *)pq;
+    if (index.line_first != NULL && index.height != height) {
+        sg_wait_gather(q, index);
+        sycl::free(index.line_first, q);
+        index.line_first = NULL;
+    }
+    if (index.line_first == NULL) {
+        index.line_first = sycl::malloc_device<int>(height + 1, q);
+        if (index.line_first == NULL) {
+            err("%s, scatter-gather index allocation failed\n", __func__);
+            return IMPL_STATUS_FAIL;
+        }
+        index.height = height;
+    }
+
+    src.seg        = pin->segments;
+    src.line_first = index.line_first;
+    src.width      = width;
+    src.fill_frame = pin->fill == IMPL_SG_FILL_FRAME ? pin->fill_frame : NULL;
+
+    const struct impl_sg_segment *seg = pin->segments;
+    const int num                     = pin->num_segments;
+    int *line_first                   = index.line_first;
+    event *gather                     = (event *)index.gather_evt;
+    IMPL_STATUS ret                   = IMPL_STATUS_SUCCESS;
+    evt                               = q.submit([&](sycl::handler &h) {
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            // the previous gather still reads the index, an in-order queue orders them anyway
+            if (gather != NULL)
+                h.depends_on(*gather);
+            // segments are ordered by line, every line looks up its first segment
+            h.parallel_for(sycl::range<1>(height + 1), [=](sycl::id<1> idx) {
+                const int y = idx[0];
+                int lo      = 0;
+                int hi      = num;
+                while (lo < hi) {
+                    int mid = (lo + hi) / 2;
+                    if (seg[mid].line < y)
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                line_first[y] = lo;
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+    // an in-order queue runs the filter kernel after the index anyway, and has no event with discard_events
+    if (q.is_in_order())
+        evt = sycl::event();
+    return ret;
+}
+
+void impl_sg_gathered(void *pq, struct sg_index &index, void *gather_evt) {
+    queue q = *(queue *)pq;
+    if (q.is_in_order() || gather_evt == NULL)
+        return;
+    if (index.gather_evt == NULL)
+        index.gather_evt = new event(*(event *)gather_evt);
+    else
+        *(event *)index.gather_evt = *(event *)gather_evt;
+}
+
+void impl_sg_free(void *pq, struct sg_index &index) {
+    queue q = *(queue *)pq;
+    if (index.line_first != NULL) {
+        sg_wait_gather(q, index);
+        sycl::free(index.line_first, q);
+        index.line_first = NULL;
+    }
+    delete (event *)index.gather_evt;
+    index.gather_evt = NULL;
+}
@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_SG_HPP__
+#define __IMPL_SG_HPP__
+
+#include "impl_common.hpp"
+#include "impl_csc_pixel.hpp"
+
+/**
+ * Device side scatter-gather yuv422ycbcr10be source, passed by value into the kernels.
+ *
+ * line_first[y] .. line_first[y + 1] are the segments of line y, built per run by
+ * impl_sg_index. Pixels not covered by any segment come from the fill frame, or are
+ * black when there is none.
+ */
+struct sg_kernel_src {
+    /** segment array in USM */
+    const struct impl_sg_segment *seg;
+    /** device index of the first segment of every line, height + 1 entries */
+    const int *line_first;
+    /** frame width in pixels */
+    uint32_t width;
+    /** contiguous yuv422ycbcr10be frame for missing pgroups, NULL for black */
+    const unsigned char *fill_frame;
+};
+
+/**
+ * Per context line index of the scatter-gather runs, all zero before the first run.
+ *
+ * Successive runs reuse the index buffer, so the index build of a run depends on the
+ * gather kernel of the previous run, and the buffer is only freed once that kernel is done.
+ */
+struct sg_index {
+    /** device index of the first segment of every line, height + 1 entries */
+    int *line_first;
+    /** frame height line_first was allocated for */
+    int height;
+    /** event of the last gather kernel reading line_first, NULL on an in-order queue */
+    void *gather_evt;
+};
+
+/* pgroup holding pixel x of line y, NULL when it is missing and fill is black */
+static inline const unsigned char *sg_pgroup(const struct sg_kernel_src &s, uint32_t x, uint32_t y) {
+    const uint32_t pg = x / 2;
+    for (int i = s.line_first[y]; i < s.line_first[y + 1]; i++) {
+        const struct impl_sg_segment seg = s.seg[i];
+        const uint32_t first             = (uint32_t)seg.offset / 2;
+        if (pg >= first && pg < first + (uint32_t)seg.length / 5)
+            return seg.buf + (pg - first) * 5;
+    }
+    if (s.fill_frame != NULL)
+        return s.fill_frame + ((size_t)y * s.width / 2 + pg) * 5;
+    return NULL;
+}
+
+static inline void sg_read_pair(const struct sg_kernel_src &s, uint32_t x, uint32_t y, csc_pair &p) {
+    const unsigned char *pgroup = sg_pgroup(s, x, y);
+    if (pgroup != NULL) {
+        csc_pack_ycbcr10be::unpack_pgroup(pgroup, p);
+    } else {
+        p.y0 = p.y1 = 64;
+        p.cb = p.cr = 512;
+    }
+}
+
+static inline unsigned short sg_read_lm(const struct sg_kernel_src &s, uint32_t x, uint32_t y) {
+    csc_pair p;
+    sg_read_pair(s, x, y, p);
+    return (x & 1) ? p.y1 : p.y0;
+}
+
+/* chroma accessors take chroma plane coordinates, as the contiguous readers */
+static inline unsigned short sg_read_cb(const struct sg_kernel_src &s, uint32_t cx, uint32_t y) {
+    csc_pair p;
+    sg_read_pair(s, cx * 2, y, p);
+    return p.cb;
+}
+
+static inline unsigned short sg_read_cr(const struct sg_kernel_src &s, uint32_t cx, uint32_t y) {
+    csc_pair p;
+    sg_read_pair(s, cx * 2, y, p);
+    return p.cr;
+}
+
+/**
+ * Validate a scatter-gather input, the segment descriptors are read on the host.
+ *
+ * @param pin
+ *   The impl_sg_input pointer.
+ * @param width
+ *   Frame width in pixels.
+ * @param height
+ *   Frame height in lines.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_INVALID_PARAMS for invalid parameters.
+ */
+IMPL_STATUS impl_sg_check(const struct impl_sg_input *pin, int width, int height);
+
+/**
+ * Build the per line segment index of a scatter-gather input on the device.
+ *
+ * The index buffer is allocated on first use and reused while the frame height is unchanged.
+ * The build waits for the gather kernel of the previous run, which still reads the buffer.
+ *
+ * @param pq
+ *   The queue pointer.
+ * @param pin
+ *   The impl_sg_input pointer.
+ * @param width
+ *   Frame width in pixels.
+ * @param height
+ *   Frame height in lines.
+ * @param index
+ *   Line index of the context, reallocated when its height differs from height.
+ * @param src
+ *   Kernel source to be filled.
+ * @param dep_evt
+ *   dep_evt is the event that the index build needs to depend on.
+ * @param evt
+ *   Event of the index build, the gather kernel must depend on it.
+ * @return
+ *   - IMPL_STATUS_SUCCESS if successful.
+ *   - IMPL_STATUS_FAIL for other failure
+ */
+IMPL_STATUS impl_sg_index(void *pq, const struct impl_sg_input *pin, int width, int height, struct sg_index &index,
+                          struct sg_kernel_src &src, void *dep_evt, sycl::event &evt);
+
+/**
+ * Record the gather kernel reading the line index, the next index build depends on it.
+ *
+ * @param pq
+ *   The queue pointer.
+ * @param index
+ *   Line index of the context.
+ * @param gather_evt
+ *   Event of the gather kernel, as written by impl_common_run_done.
+ */
+void impl_sg_gathered(void *pq, struct sg_index &index, void *gather_evt);
+
+/**
+ * Free the per line segment index once the last gather kernel is done.
+ *
+ * @param pq
+ *   The queue pointer the index was allocated on.
+ * @param index
+ *   Line index of the context.
+ */
+void impl_sg_free(void *pq, struct sg_index &index);
+
+#endif
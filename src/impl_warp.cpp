@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#include "impl_warp.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include "impl_api.h"
+#include "impl_trace.hpp"
+
+/* invert the source to destination matrix, fails when it is singular */
+static IMPL_STATUS warp_invert(const float *m, struct warp_kernel_matrix &inv) {
+    const double det = (double)m[0] * m[4] - (double)m[1] * m[3];
+    if (fabs(det) < 1e-9) {
+        err("%s, the warp matrix is singular\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    inv.m[0] = (float)(m[4] / det);
+    inv.m[1] = (float)(-m[1] / det);
+    inv.m[2] = (float)(((double)m[1] * m[5] - (double)m[4] * m[2]) / det);
+    inv.m[3] = (float)(-m[3] / det);
+    inv.m[4] = (float)(m[0] / det);
+    inv.m[5] = (float)(((double)m[3] * m[2] - (double)m[0] * m[5]) / det);
+    return IMPL_STATUS_SUCCESS;
+}
+
+/**
+ * Warp kernel. A work item maps the centers of group_width destination pixels of one row,
+ * and of the chroma samples sharing them, back to the source and interpolates there with
+ * taps clamped to the source edges. Samples whose center maps outside the source take the
+ * fill values. Results are clamped to the sample range and rounded before write().
+ */
+template <impl_video_format FORMAT, impl_interp_mtd INTERP_METHOD>
+IMPL_STATUS impl_warp_kernel(struct impl_warp_params *pwp, unsigned char *src_ptr, unsigned char *dst_ptr,
+                             void *dep_evt) {
+    IMPL_ASSERT(pwp->pq != NULL, "queue is null");
+    IMPL_ASSERT(src_ptr != NULL, "src_ptr is null");
+    IMPL_ASSERT(dst_ptr != NULL, "dst_ptr is null");
+    using fmt                 = rs_format<FORMAT>;
+    constexpr int datasize    = GetDataSize<INTERP_METHOD>();
+    constexpr int group_width = fmt::group_width;
+    constexpr float max_code  = (float)((1 << fmt::bit_depth) - 1);
+    struct warp_kernel_matrix inv;
+    IMPL_STATUS ret = warp_invert(pwp->matrix, inv);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+
+    queue q    = *(queue *)(pwp->pq);
+    auto event = q.submit([&](sycl::handler &h) {
+        const uint32_t src_width  = pwp->src_width;
+        const uint32_t src_height = pwp->src_height;
+        const uint32_t dst_width  = pwp->dst_width;
+        const uint32_t dst_height = pwp->dst_height;
+        const uint32_t pitch      = pwp->pitch_pixel;
+        const uint32_t height     = pwp->surface_height;
+        const uint32_t offset_x   = pwp->offset_x;
+        const uint32_t offset_y   = pwp->offset_y;
+        const float fill_y        = pwp->fill_y;
+        const float fill_cb       = pwp->fill_cb;
+        const float fill_cr       = pwp->fill_cr;
+
+        try {
+            if (dep_evt != NULL) {
+                auto d_evt = *(sycl::event *)dep_evt;
+                h.depends_on(d_evt);
+            }
+            h.parallel_for(sycl::range<2>(dst_height, dst_width / group_width), [=](sycl::id<2> idx) {
+                const uint32_t sy = idx[0];
+                const uint32_t sx = idx[1] * group_width;
+                auto readlm       = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_lm(src_ptr, src_width, src_height, y, x);
+                };
+                auto readcb = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_cb(src_ptr, src_width, src_height, y, x);
+                };
+                auto readcr = [&](uint32_t y, uint32_t x) {
+                    return fmt::read_cr(src_ptr, src_width, src_height, y, x);
+                };
+                // source position in luma pixels of destination point (x, y), pixel centers at + 0.5
+                auto map = [&](float x, float y, float &u, float &v) {
+                    u = inv.m[0] * x + inv.m[1] * y + inv.m[2];
+                    v = inv.m[3] * x + inv.m[4] * y + inv.m[5];
+                    return u >= 0 && v >= 0 && u < (float)src_width && v < (float)src_height;
+                };
+                auto interp = [&](float px, float py, uint32_t w, uint32_t h, auto read) {
+                    uint32_t xid[datasize], yid[datasize];
+                    float xw[datasize], yw[datasize];
+                    get_idw_at<INTERP_METHOD>(px, w, xid, xw);
+                    get_idw_at<INTERP_METHOD>(py, h, yid, yw);
+                    return sycl::floor(sycl::clamp(pixel_interp<INTERP_METHOD>(xid, xw, yid, yw, read), (float)0,
+                                                   max_code) +
+                                       (float)0.5);
+                };
+
+                float dst_lm[group_width];
+                float dst_cb[group_width / 2];
+                float dst_cr[group_width / 2];
+                float u, v;
+#pragma unroll
+                for (int i = 0; i < group_width; i++) {
+                    if (map((float)(sx + i) + (float)0.5, (float)sy + (float)0.5, u, v))
+                        dst_lm[i] = interp(u - (float)0.5, v - (float)0.5, src_width, src_height, readlm);
+                    else
+                        dst_lm[i] = fill_y;
+                }
+                const bool chroma = !fmt::is_420 || (sy % 2) == 0;
+                if (chroma) {
+                    // a chroma sample is centered on its pixel pair, and on its row pair for 4:2:0
+                    const float cy             = fmt::is_420 ? (float)sy + (float)1 : (float)sy + (float)0.5;
+                    const uint32_t src_cheight = fmt::is_420 ? src_height / 2 : src_height;
+#pragma unroll
+                    for (int i = 0; i < group_width / 2; i++) {
+                        if (map((float)(sx + i * 2) + (float)1, cy, u, v)) {
+                            const float cv = fmt::is_420 ? v / 2 : v;
+                            dst_cb[i] = interp(u / 2 - (float)0.5, cv - (float)0.5, src_width / 2, src_cheight, readcb);
+                            dst_cr[i] = interp(u / 2 - (float)0.5, cv - (float)0.5, src_width / 2, src_cheight, readcr);
+                        } else {
+                            dst_cb[i] = fill_cb;
+                            dst_cr[i] = fill_cr;
+                        }
+                    }
+                }
+                fmt::write(dst_ptr, pitch, height, sx, sy, offset_x, offset_y, dst_lm, dst_cb, dst_cr, chroma);
+            });
+        } catch (std::exception e) {
+            err("%s, SYCL exception caught: %s\n", __func__, e.what());
+            ret = IMPL_STATUS_FAIL;
+        }
+    });
+
+    impl_common_run_done(q, pwp->evt, event, pwp->is_async);
+    return ret;
+}
+
+typedef IMPL_STATUS (*WARP_function)(struct impl_warp_params *pwp, unsigned char *buf_in, unsigned char *buf_out,
+                                     void *dep_evt);
+
+#define WARP_FUNCTIONS(FORMAT)                                                                                         \
+    impl_warp_kernel<FORMAT, IMPL_INTERP_MTD_BILINEAR>, impl_warp_kernel<FORMAT, IMPL_INTERP_MTD_BICUBIC>,             \
+        impl_warp_kernel<FORMAT, IMPL_INTERP_MTD_NEAREST>
+
+constexpr WARP_function WarpFunctionList[IMPL_VIDEO_MAX * WARP_INTERP_MTD_MAX] = {
+    WARP_FUNCTIONS(IMPL_VIDEO_I420),
+    WARP_FUNCTIONS(IMPL_VIDEO_V210),
+    WARP_FUNCTIONS(IMPL_VIDEO_Y210),
+    WARP_FUNCTIONS(IMPL_VIDEO_NV12),
+    WARP_FUNCTIONS(IMPL_VIDEO_P010),
+    WARP_FUNCTIONS(IMPL_VIDEO_YUV420P10LE),
+    WARP_FUNCTIONS(IMPL_VIDEO_YUV422P10LE),
+    WARP_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10BE),
+    WARP_FUNCTIONS(IMPL_VIDEO_YUV422YCBCR10LE)};
+
+IMPL_STATUS impl_warp_init(struct impl_warp_params *pwp, void *&pwp_context) {
+    IMPL_ASSERT(pwp != NULL, "warp init failed, pwp is null");
+    IMPL_ASSERT(pwp->pq != NULL, "warp init failed, pq is null");
+    if (pwp->format < 0 || pwp->format >= IMPL_VIDEO_MAX) {
+        err("%s, unsupported format %d\n", __func__, pwp->format);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (pwp->interp_mtd < 0 || pwp->interp_mtd >= WARP_INTERP_MTD_MAX) {
+        err("%s, invalid interpolation method %d, warp supports bilinear, bicubic and nearest\n", __func__,
+            pwp->interp_mtd);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (!(pwp->src_width > 0 && pwp->src_height > 0 && pwp->dst_width > 0 && pwp->dst_height > 0) ||
+        (pwp->src_width % 2) != 0 || (pwp->src_height % 2) != 0 || (pwp->dst_width % 2) != 0 ||
+        (pwp->dst_height % 2) != 0) {
+        err("%s, Illegal size: The width and height must be a multiple of 2\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    if (IMPL_VIDEO_V210 == pwp->format && ((pwp->src_width % 48) != 0 || (pwp->dst_width % 48) != 0)) {
+        err("%s, Illegal V210 size: The width must be a multiple of 48\n", __func__);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    const int align_x = IMPL_VIDEO_V210 == pwp->format ? 6 : 2;
+    if (pwp->pitch_pixel == 0)
+        pwp->pitch_pixel = pwp->dst_width;
+    if (pwp->surface_height == 0)
+        pwp->surface_height = pwp->dst_height;
+    if (pwp->offset_x < 0 || pwp->offset_y < 0 || pwp->offset_x + pwp->dst_width > pwp->pitch_pixel ||
+        pwp->offset_y + pwp->dst_height > pwp->surface_height || (pwp->offset_x % align_x) != 0 ||
+        (pwp->offset_y % 2) != 0) {
+        err("%s, destination %dx%d at (%d, %d) does not fit the %dx%d surface\n", __func__, pwp->dst_width,
+            pwp->dst_height, pwp->offset_x, pwp->offset_y, pwp->pitch_pixel, pwp->surface_height);
+        return IMPL_STATUS_INVALID_PARAMS;
+    }
+    struct warp_kernel_matrix inv;
+    IMPL_STATUS ret = warp_invert(pwp->matrix, inv);
+    if (ret != IMPL_STATUS_SUCCESS)
+        return ret;
+
+    impl_warp_context *pcontext = new impl_warp_context;
+    memset(pcontext, 0, sizeof(impl_warp_context));
+    pcontext->warp_func_index = (int)pwp->format * WARP_INTERP_MTD_MAX + (int)pwp->interp_mtd;
+    pwp->evt                  = impl_common_new_event();
+    pwp_context               = (void *)pcontext;
+    return IMPL_STATUS_SUCCESS;
+}
+
+IMPL_STATUS impl_warp_run(struct impl_warp_params *pwp, void *pwp_context, unsigned char *buf_in,
+                          unsigned char *buf_out, void *dep_evt) {
+    IMPL_ASSERT(pwp != NULL, "warp run failed, pwp is null");
+    IMPL_ASSERT(pwp_context != NULL, "warp run failed, pwp_context is null");
+    struct impl_warp_context *pcontext = (struct impl_warp_context *)pwp_context;
+    IMPL_STATUS ret = WarpFunctionList[pcontext->warp_func_index](pwp, buf_in, buf_out, dep_evt);
+    IMPL_ASSERT(ret >= 0, "warp function failed");
+    return ret;
+}
+
+IMPL_STATUS impl_warp_run_evt(struct impl_warp_params *pwp, void *pwp_context, unsigned char *buf_in,
+                              unsigned char *buf_out, void *dep_evt, void *&evt) {
+    IMPL_ASSERT(pwp != NULL, "warp run failed, pwp is null");
+    return impl_common_run_evt(pwp, evt, impl_warp_run, pwp_context, buf_in, buf_out, dep_evt);
+}
+
+IMPL_STATUS impl_warp_uninit(struct impl_warp_params *pwp, void *pwp_context) {
+    IMPL_ASSERT(pwp != NULL, "warp uninit failed, pwp is null");
+    IMPL_ASSERT(pwp_context != NULL, "warp uninit failed, pwp_context is null");
+    impl_common_free_event(pwp->evt);
+    delete (struct impl_warp_context *)pwp_context;
+    return IMPL_STATUS_SUCCESS;
+}
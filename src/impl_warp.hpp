@@ -0,0 +1,24 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2023 Intel Corporation
+ */
+
+#ifndef __IMPL_WARP_HPP__
+#define __IMPL_WARP_HPP__
+
+#include "impl_common.hpp"
+#include "impl_resize_format.hpp"
+
+/* interpolation methods with a warp kernel, area has no footprint at a single position */
+#define WARP_INTERP_MTD_MAX (IMPL_INTERP_MTD_NEAREST + 1)
+
+struct impl_warp_context {
+    /** IMPL warp function index */
+    int warp_func_index;
+};
+
+/* inverse affine mapping, destination pixel centers to source coordinates */
+struct warp_kernel_matrix {
+    float m[6];
+};
+
+#endif